@@ -26,7 +26,10 @@
 #include "mkl_lapack.h"
 #include "mkl.h"
 
+#define TBB_PREVIEW_TASK_GROUP_EXTENSIONS 1
+
 #include "oneapi/tbb/flow_graph.h"
+#include "oneapi/tbb/task_group.h"
 #include "oneapi/tbb/tick_count.h"
 #include "oneapi/tbb/global_control.h"
 
@@ -616,6 +619,84 @@ protected:
  End dependence graph based version of cholesky
 ************************************************************/
 
+/************************************************************
+ Begin task graph based version of cholesky
+************************************************************/
+
+// The same dependency graph as in algorithm_depend made of deferred tasks
+// of a task_group connected with make_edge instead of flow graph nodes.
+class algorithm_task_dag : public algorithm {
+public:
+    algorithm_task_dag() : algorithm("task_dag_cholesky", true) {}
+
+protected:
+    virtual void func(void *ptr, int n, int b) {
+        double ***tile = (double ***)ptr;
+
+        const int p = n / b;
+        std::vector<oneapi::tbb::task_handle> c(p);
+        std::vector<std::vector<oneapi::tbb::task_handle>> t(p);
+        std::vector<std::vector<std::vector<oneapi::tbb::task_handle>>> u(p);
+
+        oneapi::tbb::task_group tg;
+        for (int k = p - 1; k >= 0; --k) {
+            c[k] = tg.defer([=] {
+                call_dpotf2(tile, b, k);
+            });
+            t[k].resize(p);
+            u[k].resize(p);
+
+            for (int j = k + 1; j < p; ++j) {
+                t[k][j] = tg.defer([=] {
+                    call_dtrsm(tile, b, k, j);
+                });
+                oneapi::tbb::make_edge(c[k], t[k][j]);
+                u[k][j].resize(p);
+
+                for (int i = k + 1; i <= j; ++i) {
+                    u[k][j][i] = tg.defer([=] {
+                        call_dsyr2k(tile, b, k, j, i);
+                    });
+
+                    if (k < p - 2 && k + 1 != j && k + 1 != i) {
+                        oneapi::tbb::make_edge(u[k][j][i], u[k + 1][j][i]);
+                    }
+
+                    oneapi::tbb::make_edge(t[k][j], u[k][j][i]);
+
+                    if (i != j) {
+                        oneapi::tbb::make_edge(t[k][i], u[k][j][i]);
+                    }
+
+                    if (k < p - 2 && j > i && i == k + 1) {
+                        oneapi::tbb::make_edge(u[k][j][i], t[i][j]);
+                    }
+                }
+            }
+
+            if (k != p - 1) {
+                oneapi::tbb::make_edge(u[k][k + 1][k + 1], c[k + 1]);
+            }
+        }
+
+        // Submit all tasks, each of them starts when its predecessors complete
+        for (int k = 0; k < p; ++k) {
+            for (int j = k + 1; j < p; ++j) {
+                for (int i = k + 1; i <= j; ++i) {
+                    tg.run(std::move(u[k][j][i]));
+                }
+                tg.run(std::move(t[k][j]));
+            }
+            tg.run(std::move(c[k]));
+        }
+        tg.wait();
+    }
+}; // class algorithm_task_dag
+
+/************************************************************
+ End task graph based version of cholesky
+************************************************************/
+
 bool process_args(int argc, char *argv[]) {
     utility::parse_cli_arguments(
         argc,
@@ -635,7 +716,7 @@ bool process_args(int argc, char *argv[]) {
                 "                 if output_prefix is not provided, no output will be written")
             .positional_arg(g_alg_name,
                             "algorithm",
-                            "name of the used algorithm - can be dpotrf, crout, depend or join")
+                            "name of the used algorithm - can be dpotrf, crout, depend, join or task_dag")
             .positional_arg(g_num_tbb_threads, "num_tbb_threads", "number of started TBB threads")
 
             .arg(g_input_file_name,
@@ -679,6 +760,7 @@ int main(int argc, char *argv[]) {
     algmap.insert(std::pair<std::string, algorithm *>("crout", new algorithm_crout));
     algmap.insert(std::pair<std::string, algorithm *>("depend", new algorithm_depend));
     algmap.insert(std::pair<std::string, algorithm *>("join", new algorithm_join));
+    algmap.insert(std::pair<std::string, algorithm *>("task_dag", new algorithm_task_dag));
 
     if (!process_args(argc, argv)) {
         printf("ERROR: Invalid arguments. Run: %s -h\n", argv[0]);
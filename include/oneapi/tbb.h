@@ -56,6 +56,9 @@
 #include "oneapi/tbb/parallel_invoke.h"
 #include "oneapi/tbb/parallel_pipeline.h"
 #include "oneapi/tbb/parallel_reduce.h"
+#if TBB_PREVIEW_PARALLEL_REGION
+#include "tbb/parallel_region.h"
+#endif
 #include "oneapi/tbb/parallel_scan.h"
 #include "oneapi/tbb/parallel_sort.h"
 #include "oneapi/tbb/partitioner.h"
@@ -512,6 +512,14 @@
 #define __TBB_PREVIEW_FLOW_GRAPH_NODE_SET       (TBB_PREVIEW_FLOW_GRAPH_FEATURES)
 #endif
 
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+#define __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING (TBB_PREVIEW_FLOW_GRAPH_FEATURES)
+#endif
+
+#ifndef __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+#define __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS     (TBB_PREVIEW_FLOW_GRAPH_FEATURES)
+#endif
+
 #if TBB_PREVIEW_CONCURRENT_HASH_MAP_EXTENSIONS
 #define __TBB_PREVIEW_CONCURRENT_HASH_MAP_EXTENSIONS 1
 #endif
@@ -520,4 +528,12 @@
 #define __TBB_PREVIEW_TASK_GROUP_EXTENSIONS 1
 #endif
 
+#if TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+#define __TBB_PREVIEW_NOEXCEPT_ALGORITHMS 1
+#endif
+
+#if TBB_PREVIEW_ADAPTIVE_PARTITIONER
+#define __TBB_PREVIEW_ADAPTIVE_PARTITIONER 1
+#endif
+
 #endif // __TBB_detail__config_H
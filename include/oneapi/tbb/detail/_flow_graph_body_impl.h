@@ -49,6 +49,10 @@ namespace graph_policy_namespace {
     struct reserving { };
     struct queueing  { };
     struct lightweight  { };
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    // sequencer_node and priority_queue_node accept items without the node aggregator
+    struct lock_free_buffering { };
+#endif
 
     // K == type of field used for key-matching.  Each tag-matching port will be provided
     // functor that, given an object accepted by the port, will return the
@@ -323,6 +327,64 @@ public:
     }
 };
 
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+//! A task that spawns a list of tasks gathered outside of the graph arena
+/** A single submission to the arena replaces a submission per task; the thread that takes
+    this task spawns the rest of the list locally and bypasses to the first task. */
+class spawn_task_list_task : public graph_task {
+    graph_task_list my_tasks;
+public:
+    spawn_task_list_task( graph& g, small_object_allocator& allocator, graph_task_list& tasks )
+        : graph_task(g, allocator)
+    {
+        while (!tasks.empty()) {
+            my_tasks.push_back(tasks.pop_front());
+        }
+    }
+
+    task* execute(execution_data& ed) override {
+        graph& g = my_graph;
+        graph_task& first = my_tasks.pop_front();
+        while (!my_tasks.empty()) {
+            spawn_in_graph_arena(g, my_tasks.pop_front());
+        }
+        task* next_task = prioritize_task(g, first);
+        finalize<spawn_task_list_task>(ed);
+        return next_task;
+    }
+
+    task* cancel(execution_data& ed) override {
+        // Each task of the list releases its own graph reservation
+        while (!my_tasks.empty()) {
+            my_tasks.pop_front().cancel(ed);
+        }
+        finalize<spawn_task_list_task>(ed);
+        return nullptr;
+    }
+};
+
+//! A task that calls a node's poll_completions function
+template< typename NodeType >
+class async_poll_task : public graph_task {
+    NodeType &my_node;
+public:
+    async_poll_task( graph& g, small_object_allocator& allocator, NodeType &n )
+        : graph_task(g, allocator), my_node(n) {}
+
+    task* execute(execution_data& ed) override {
+        my_node.poll_completions();
+        finalize<async_poll_task>(ed);
+        return nullptr;
+    }
+
+    task* cancel(execution_data& ed) override {
+        my_node.cancel_polling();
+        finalize<async_poll_task>(ed);
+        return nullptr;
+    }
+};
+#endif // __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+
 // ------------------------ end of node task bodies -----------------------------------
 
 template<typename T, typename DecrementType, typename DummyType = void>
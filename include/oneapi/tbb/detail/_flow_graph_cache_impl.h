@@ -390,6 +390,38 @@ public:
         }
         return is_at_least_one_put_successful;
     }
+
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+    // gather_successful_try_puts for a batch of items under a single lock;
+    // returns the number of items accepted by at least one successor
+    std::size_t gather_successful_try_puts( const T* first, std::size_t count, graph_task_list& tasks ) {
+        std::size_t accepted = 0;
+        typename mutex_type::scoped_lock l(this->my_mutex, /*write=*/true);
+        for (std::size_t k = 0; k < count; ++k) {
+            bool is_put_successful = false;
+            typename successors_type::iterator i = this->my_successors.begin();
+            while ( i != this->my_successors.end() ) {
+                graph_task * new_task = (*i)->try_put_task(first[k]);
+                if(new_task) {
+                    ++i;
+                    if(new_task != SUCCESSFULLY_ENQUEUED) {
+                        tasks.push_back(*new_task);
+                    }
+                    is_put_successful = true;
+                }
+                else {  // failed
+                    if ( (*i)->register_predecessor(*this->my_owner) ) {
+                        i = this->my_successors.erase(i);
+                    } else {
+                        ++i;
+                    }
+                }
+            }
+            accepted += is_put_successful ? 1 : 0;
+        }
+        return accepted;
+    }
+#endif
 };
 
 //! A cache of successors that are put in a round-robin fashion
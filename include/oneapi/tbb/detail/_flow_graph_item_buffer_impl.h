@@ -276,4 +276,227 @@ protected:
     bool my_reserved;
 };
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+//! Placeholder for the staging area of the nodes that buffer items under the aggregator only
+struct null_item_staging {
+    void reset() {}
+};
+
+//! Common part of the staging areas where producers hand over items without the node aggregator.
+/** A producer that finds no pending forwarding request posts one operation to the aggregator;
+    the handler withdraws the request before it takes the staged items, so no item is left behind. */
+class item_staging_base : no_copy {
+public:
+    //! Returns true if the caller has to post a forwarding request to the node aggregator
+    bool request_forwarding() {
+        return !my_forwarding_requested.load(std::memory_order_relaxed) && !my_forwarding_requested.exchange(true);
+    }
+
+    //! Called by the aggregator handler before it takes the staged items
+    void withdraw_forwarding_request() {
+        my_forwarding_requested.store(false);
+    }
+
+private:
+    std::atomic<bool> my_forwarding_requested{false};
+};
+
+//! Window of items indexed by their sequence numbers.
+/** Slot i holds items with the tags equal to i modulo the capacity. The state word of a slot
+    keeps the tag the slot expects next together with the empty, busy or full state,
+    so a producer claims the slot with a single CAS and a duplicate or stale tag fails to claim it.
+    Items are taken in the tag order by one consumer at a time. */
+template <typename T, typename A = cache_aligned_allocator<T>>
+class sequencer_ring : public item_staging_base {
+public:
+    typedef size_t size_type;
+    enum class place_status { placed, placed_at_head, duplicate, out_of_window };
+
+    static constexpr size_type default_capacity = 1024;
+
+    explicit sequencer_ring(size_type capacity = default_capacity) : my_capacity(capacity) {
+        __TBB_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0, "The capacity must be a power of two");
+        my_slots = slot_allocator_type().allocate(my_capacity);
+        for (size_type i = 0; i < my_capacity; ++i) {
+            new (my_slots + i) slot(i << state_bits);
+        }
+    }
+
+    ~sequencer_ring() {
+        clear();
+        for (size_type i = 0; i < my_capacity; ++i) {
+            my_slots[i].~slot();
+        }
+        slot_allocator_type().deallocate(my_slots, my_capacity);
+    }
+
+    //! Tag of the next item to be taken
+    size_type head() const {
+        return my_head.load(std::memory_order_acquire);
+    }
+
+    //! Places a copy of the item; may be called concurrently with other producers and the consumer
+    place_status try_place(size_type tag, const T& item) {
+        const size_type head_tag = my_head.load(std::memory_order_acquire);
+        if (tag < head_tag) {
+            return place_status::duplicate;
+        }
+        if (tag - head_tag >= my_capacity) {
+            return place_status::out_of_window;
+        }
+        slot& s = my_slots[tag & (my_capacity - 1)];
+        size_type expected = state(tag, empty);
+        if (!s.state.compare_exchange_strong(expected, state(tag, busy))) {
+            // Either the tag is already placed or the window has moved past it
+            return place_status::duplicate;
+        }
+        new (s.item.begin()) T(item);
+        s.state.store(state(tag, full));
+        // Pairs with the store of my_head in take/skip: either the consumer sees the full slot,
+        // or the producer sees that the item is at the head and has to request forwarding
+        return tag == my_head.load() ? place_status::placed_at_head : place_status::placed;
+    }
+
+    //! Passes the item with the head tag to the consumer and advances the head, if the item is placed
+    template <typename Consumer>
+    bool try_take(Consumer&& consume) {
+        const size_type head_tag = my_head.load(std::memory_order_relaxed);
+        slot& s = my_slots[head_tag & (my_capacity - 1)];
+        if (s.state.load() != state(head_tag, full)) {
+            return false;
+        }
+        consume(head_tag, *s.item.begin());
+        retire(s, head_tag);
+        return true;
+    }
+
+    //! Advances the head past a tag whose item is buffered elsewhere; a duplicate in the ring is discarded
+    void skip() {
+        const size_type head_tag = my_head.load(std::memory_order_relaxed);
+        slot& s = my_slots[head_tag & (my_capacity - 1)];
+        for (atomic_backoff backoff;; backoff.pause()) {
+            size_type expected = state(head_tag, empty);
+            if (s.state.compare_exchange_strong(expected, state(head_tag + my_capacity, empty))) {
+                my_head.store(head_tag + 1);
+                return;
+            }
+            if (expected == state(head_tag, full)) {
+                retire(s, head_tag);
+                return;
+            }
+            // A duplicate is being copied into the slot
+        }
+    }
+
+    //! Destroys the placed items and rewinds the window to the tag 0; the node must be quiescent
+    void reset() {
+        clear();
+        for (size_type i = 0; i < my_capacity; ++i) {
+            my_slots[i].state.store(state(i, empty), std::memory_order_relaxed);
+        }
+        my_head.store(0, std::memory_order_relaxed);
+        withdraw_forwarding_request();
+    }
+
+private:
+    static constexpr size_type empty = 0, busy = 1, full = 2;
+    static constexpr unsigned state_bits = 2;
+
+    static size_type state(size_type tag, size_type s) {
+        return tag << state_bits | s;
+    }
+
+    struct slot {
+        explicit slot(size_type initial) : state(initial) {}
+        std::atomic<size_type> state;
+        aligned_space<T> item;
+    };
+    typedef typename allocator_traits<A>::template rebind_alloc<slot> slot_allocator_type;
+
+    void retire(slot& s, size_type head_tag) {
+        s.item.begin()->~T();
+        s.state.store(state(head_tag + my_capacity, empty), std::memory_order_release);
+        my_head.store(head_tag + 1);
+    }
+
+    void clear() {
+        for (size_type i = 0; i < my_capacity; ++i) {
+            if ((my_slots[i].state.load(std::memory_order_relaxed) & (full | busy)) == full) {
+                my_slots[i].item.begin()->~T();
+            }
+        }
+    }
+
+    const size_type my_capacity;
+    slot* my_slots;
+    alignas(max_nfs_size) std::atomic<size_type> my_head{0};
+};
+
+//! Unordered staging area: lock-free stacks sharded by the producer thread
+/** The consumer takes whole stacks at once, so it touches each shard once per aggregator pass. */
+template <typename T>
+class sharded_item_staging : public item_staging_base {
+public:
+    static constexpr std::size_t num_shards = 16;
+
+    ~sharded_item_staging() {
+        reset();
+    }
+
+    //! Stages a copy of the item; may be called concurrently with other producers and the consumer
+    void push(const T& item) {
+        node* n = new (tbb_allocator<node>().allocate(1)) node(item);
+        std::atomic<node*>& top = my_shards[shard_index(&n)].top;
+        n->next = top.load(std::memory_order_relaxed);
+        while (!top.compare_exchange_weak(n->next, n)) {}
+    }
+
+    //! Passes every staged item to the consumer
+    template <typename Consumer>
+    void take_all(Consumer&& consume) {
+        for (shard& s : my_shards) {
+            if (s.top.load(std::memory_order_relaxed) == nullptr) {
+                continue;
+            }
+            for (node* n = s.top.exchange(nullptr); n != nullptr;) {
+                node* next = n->next;
+                consume(n->item);
+                destroy(n);
+                n = next;
+            }
+        }
+    }
+
+    //! Destroys the staged items; the node must be quiescent
+    void reset() {
+        take_all([](const T&) {});
+        withdraw_forwarding_request();
+    }
+
+private:
+    struct node {
+        explicit node(const T& i) : next(nullptr), item(i) {}
+        node* next;
+        T item;
+    };
+
+    struct alignas(max_nfs_size) shard {
+        std::atomic<node*> top{nullptr};
+    };
+
+    static void destroy(node* n) {
+        n->~node();
+        tbb_allocator<node>().deallocate(n, 1);
+    }
+
+    //! Threads run on distinct stacks, so a hash of a stack address spreads the producers over the shards
+    static std::size_t shard_index(const void* stack_address) {
+        const std::uint64_t page = std::uint64_t(reinterpret_cast<std::uintptr_t>(stack_address) >> 12);
+        return std::size_t((page * 0x9E3779B97F4A7C15ull) >> 32) % num_shards;
+    }
+
+    shard my_shards[num_shards];
+};
+#endif // __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+
 #endif // __TBB__flow_graph_item_buffer_impl_H
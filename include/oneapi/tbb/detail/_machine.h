@@ -103,6 +103,24 @@ static inline void machine_pause(int32_t delay) {
 #endif
 }
 
+//--------------------------------------------------------------------------------------------------
+// Time stamp counter
+//--------------------------------------------------------------------------------------------------
+
+#if __TBB_x86_64 || __TBB_x86_32
+static inline std::uint64_t machine_time_stamp() {
+#if __INTEL_COMPILER
+    return _rdtsc();
+#elif _MSC_VER
+    return __rdtsc();
+#else
+    std::uint32_t hi, lo;
+    __asm__ __volatile__("rdtsc" : "=d"(hi), "=a"(lo));
+    return (std::uint64_t(hi) << 32) | lo;
+#endif
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // tbb::detail::log2() implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////
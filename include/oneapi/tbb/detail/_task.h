@@ -41,6 +41,7 @@ constexpr slot_id any_slot = slot_id(~1);
 
 class task;
 class wait_context;
+class reference_vertex;
 class task_group_context;
 struct execution_data;
 }
@@ -63,6 +64,11 @@ TBB_EXPORT void __TBB_EXPORTED_FUNC resume(suspend_point_type* tag);
 TBB_EXPORT suspend_point_type* __TBB_EXPORTED_FUNC current_suspend_point();
 TBB_EXPORT void __TBB_EXPORTED_FUNC notify_waiters(std::uintptr_t wait_ctx_addr);
 
+//! Returns the calling thread's reference vertex for the given wait context
+TBB_EXPORT d1::reference_vertex* __TBB_EXPORTED_FUNC get_thread_reference_vertex(d1::wait_context*);
+//! Reference vertices are allocated by the library and deallocated by the last releasing thread
+TBB_EXPORT void __TBB_EXPORTED_FUNC cache_aligned_deallocate(void* p);
+
 class thread_data;
 class task_dispatcher;
 class external_waiter;
@@ -147,6 +153,93 @@ public:
     }
 };
 
+//! Per-thread intermediate node of the reference counting tree built over a shared wait_context.
+/** Tasks created by a thread reserve and release the thread's own vertex, and only the
+    transitions of the vertex reference count between zero and non-zero are propagated
+    to the parent wait_context. It keeps the hot reference counting off the cache line of
+    the wait_context that is shared by all producers (SNZI-like scheme).
+    The vertex is reserved only by its owning thread but can be released by any thread.
+    If the owning thread exits while the vertex is still referenced, the vertex is orphaned
+    and the last release deallocates it. **/
+class reference_vertex {
+    static constexpr std::uint64_t orphaned_flag = std::uint64_t(1) << 63;
+    static constexpr std::uint64_t underflow_mask = std::uint64_t(1) << 62;
+
+    wait_context* m_parent;
+    std::atomic<std::uint64_t> m_ref_count{};
+
+public:
+    reference_vertex(wait_context& parent) : m_parent(&parent) {}
+    reference_vertex(const reference_vertex&) = delete;
+
+    void reserve(std::uint32_t delta = 1) {
+        __TBB_ASSERT((m_ref_count.load(std::memory_order_relaxed) & orphaned_flag) == 0,
+            "Orphaned vertex cannot be reserved");
+        if (m_ref_count.fetch_add(delta) == 0) {
+            m_parent->reserve();
+        }
+    }
+
+    void release(std::uint32_t delta = 1) {
+        // The vertex can be reused or deallocated as soon as the count drops to zero,
+        // so the parent must be read before the decrement.
+        wait_context* parent = m_parent;
+        std::uint64_t r = m_ref_count.fetch_sub(delta) - delta;
+        __TBB_ASSERT_EX((r & underflow_mask) == 0, "Underflow is detected");
+        if ((r & ~orphaned_flag) == 0) {
+            if (r & orphaned_flag) {
+                r1::cache_aligned_deallocate(this);
+            }
+            parent->release();
+        }
+    }
+
+    //! Called by the owning thread that leaves while the vertex may be still referenced.
+    /** \return true if the vertex is not referenced and the caller is responsible to deallocate it. */
+    bool orphan() {
+        return (m_ref_count.fetch_or(orphaned_flag) & ~orphaned_flag) == 0;
+    }
+
+    std::uint64_t get_num_child() const {
+        return m_ref_count.load(std::memory_order_acquire) & ~orphaned_flag;
+    }
+
+    wait_context* parent() const {
+        return m_parent;
+    }
+};
+
+//! Returns the reference vertex of the calling thread that accounts its tasks in the wait context
+inline reference_vertex& get_thread_reference_vertex(wait_context& wait_ctx) {
+    return *r1::get_thread_reference_vertex(&wait_ctx);
+}
+
+//! Accounts a new task of the calling thread in the wait context shared with other producers
+/** \return the vertex that should be released when the task completes. */
+inline reference_vertex& reserve_thread_reference_vertex(wait_context& wait_ctx) {
+    reference_vertex& vertex = get_thread_reference_vertex(wait_ctx);
+    vertex.reserve();
+    return vertex;
+}
+
+//! Reference of a task to the wait context, either direct or through a reference vertex
+class wait_reference {
+    wait_context& m_wait_ctx;
+    reference_vertex* m_vertex;
+
+public:
+    wait_reference(wait_context& wait_ctx, reference_vertex* vertex = nullptr)
+        : m_wait_ctx(wait_ctx), m_vertex(vertex) {}
+
+    void release() {
+        if (m_vertex) {
+            m_vertex->release();
+        } else {
+            m_wait_ctx.release();
+        }
+    }
+};
+
 struct execution_data {
     task_group_context* context{};
     slot_id original_slot{};
@@ -22,21 +22,97 @@
 #include "_task.h"
 #include "_small_object_pool.h"
 #include "_utils.h"
+#include <atomic>
 #include <memory>
 
 namespace tbb {
 namespace detail {
 
-namespace d1 { class task_group_context; class wait_context; struct execution_data; }
+namespace d1 { class task_group_context; class wait_reference; struct execution_data; }
 namespace d2 {
 
 class task_handle;
 
 class task_handle_task : public d1::task {
+    //! Chunk of the list of tasks that wait for the completion of this one
+    /** Successors are kept in chunks not to allocate a small object per edge. **/
+    struct successor_node {
+        static constexpr std::size_t capacity = 12;
+
+        successor_node(successor_node* n, d1::small_object_allocator& a) : next(n), allocator(a) {}
+        task_handle_task* tasks[capacity];
+        std::size_t size{0};
+        successor_node* next;
+        d1::small_object_allocator allocator;
+    };
+
     std::uint64_t m_version_and_traits{};
-    d1::wait_context& m_wait_ctx;
+    d1::wait_reference m_wait_ref;
     d1::task_group_context& m_ctx;
     d1::small_object_allocator m_allocator;
+    //! The number of unfinished predecessors plus one until the task is submitted
+    std::atomic<std::uint32_t> m_dependencies{1};
+    //! The handle was destroyed without submitting the task
+    bool m_discarded{false};
+    successor_node* m_successors{nullptr};
+
+    //! Returns true if the task has no more unfinished predecessors and is submitted
+    bool release_dependency() {
+        // The last dependency is not shared with other threads, so the atomic RMW is not needed
+        return m_dependencies.load(std::memory_order_acquire) == 1 || m_dependencies.fetch_sub(1) == 1;
+    }
+
+    //! Releases the successors of the completed task
+    /** Returns the first successor that becomes ready, the others are spawned.
+        The successors of discarded tasks are released as if the discarded tasks were completed. **/
+    task_handle_task* release_successors(const d1::execution_data* ed) {
+        task_handle_task* next = nullptr;
+        successor_node* node = m_successors;
+        m_successors = nullptr;
+        while (node) {
+            for (std::size_t i = 0; i < node->size; ++i) {
+                task_handle_task* successor = node->tasks[i];
+                if (successor->release_dependency()) {
+                    if (successor->m_discarded) {
+                        task_handle_task* ready = successor->release_successors(ed);
+                        successor->finalize(ed);
+                        successor = ready;
+                    }
+                    if (successor) {
+                        if (next) {
+                            d1::spawn(*successor, successor->ctx());
+                        } else {
+                            next = successor;
+                        }
+                    }
+                }
+            }
+            successor_node* next_node = node->next;
+            if (ed) {
+                node->allocator.delete_object(node, *ed);
+            } else {
+                node->allocator.delete_object(node);
+            }
+            node = next_node;
+        }
+        return next;
+    }
+
+protected:
+    //! Releases the successors and returns the task to be executed next
+    d1::task* complete(d1::task* next, const d1::execution_data& ed) {
+        if (m_successors) {
+            if (task_handle_task* successor = release_successors(&ed)) {
+                if (next) {
+                    d1::spawn(*successor, successor->ctx());
+                } else {
+                    next = successor;
+                }
+            }
+        }
+        return next;
+    }
+
 public:
     void finalize(const d1::execution_data* ed = nullptr) {
         if (ed) {
@@ -46,24 +122,87 @@ public:
         }
     }
 
-    task_handle_task(d1::wait_context& wo, d1::task_group_context& ctx, d1::small_object_allocator& alloc)
-        : m_wait_ctx(wo)
+    task_handle_task(d1::wait_reference wo, d1::task_group_context& ctx, d1::small_object_allocator& alloc)
+        : m_wait_ref(wo)
         , m_ctx(ctx)
         , m_allocator(alloc) {
         suppress_unused_warning(m_version_and_traits);
     }
 
     ~task_handle_task() override {
-        m_wait_ctx.release();
+        __TBB_ASSERT(m_successors == nullptr, "The successors of the task are not released");
+        m_wait_ref.release();
     }
 
     d1::task_group_context& ctx() const { return m_ctx; }
+
+    //! Makes the successor wait for the completion of this task
+    void add_successor(task_handle_task& successor) {
+        __TBB_ASSERT(&successor != this, "A task cannot precede itself");
+        __TBB_ASSERT(&successor.ctx() == &ctx(), "Dependent tasks must belong to the same task_group");
+        successor.m_dependencies.fetch_add(1);
+        if (!m_successors || m_successors->size == successor_node::capacity) {
+            d1::small_object_allocator alloc{};
+            m_successors = alloc.new_object<successor_node>(m_successors, alloc);
+        }
+        m_successors->tasks[m_successors->size++] = &successor;
+    }
+
+    //! Makes the successors of this task wait for the receiver instead
+    void transfer_successors_to(task_handle_task& receiver) {
+        __TBB_ASSERT(&receiver != this, "A task cannot transfer its completion to itself");
+        __TBB_ASSERT(&receiver.ctx() == &ctx(), "Dependent tasks must belong to the same task_group");
+        if (m_successors) {
+            successor_node* last = m_successors;
+            while (last->next) {
+                last = last->next;
+            }
+            last->next = receiver.m_successors;
+            receiver.m_successors = m_successors;
+            m_successors = nullptr;
+        }
+    }
+
+    //! Returns the task if it is ready to execute, otherwise it is started by its last predecessor
+    task_handle_task* submit() {
+        return release_dependency() ? this : nullptr;
+    }
+
+    //! Destroys the task that is never submitted
+    void discard() {
+        m_discarded = true;
+        if (release_dependency()) {
+            if (task_handle_task* successor = release_successors(nullptr)) {
+                d1::spawn(*successor, successor->ctx());
+            }
+            finalize();
+        }
+    }
 };
 
 
+//! The task created with task_group::defer that is executed by the calling thread
+inline task_handle_task*& current_task_handle_task() {
+    static thread_local task_handle_task* current{nullptr};
+    return current;
+}
+
+//! Sets the current task_handle task for the scope and restores the outer one after it
+class current_task_guard {
+    task_handle_task* m_outer;
+public:
+    current_task_guard(task_handle_task* t) : m_outer(current_task_handle_task()) {
+        current_task_handle_task() = t;
+    }
+    current_task_guard(const current_task_guard&) = delete;
+    ~current_task_guard() {
+        current_task_handle_task() = m_outer;
+    }
+};
+
 class task_handle {
     struct task_handle_task_finalizer_t{
-        void operator()(task_handle_task* p){ p->finalize(); }
+        void operator()(task_handle_task* p){ p->discard(); }
     };
     using handle_impl_t = std::unique_ptr<task_handle_task, task_handle_task_finalizer_t>;
 
@@ -87,13 +226,19 @@ private:
     task_handle(task_handle_task* t) : m_handle {t}{};
 
     d1::task* release() {
-       return m_handle.release();
+        task_handle_task* t = m_handle.release();
+        return t ? t->submit() : nullptr;
+    }
+
+    task_handle_task* get() const {
+        return m_handle.get();
     }
 };
 
 struct task_handle_accessor {
 static task_handle              construct(task_handle_task* t)  { return {t}; }
 static d1::task*                release(task_handle& th)        { return th.release(); }
+static task_handle_task*        get(task_handle& th)            { return th.get(); }
 static d1::task_group_context&  ctx_of(task_handle& th)         {
     __TBB_ASSERT(th.m_handle, "ctx_of does not expect empty task_handle.");
     return th.m_handle->ctx();
@@ -31,6 +31,7 @@
 #include "detail/_task.h"
 #include "detail/_small_object_pool.h"
 #include "cache_aligned_allocator.h"
+#include "tbb_allocator.h"
 #include "detail/_exception.h"
 #include "detail/_template_helpers.h"
 #include "detail/_aggregator.h"
@@ -1171,6 +1172,9 @@ protected:
     friend class forward_task_bypass< class_type >;
 
     enum op_type {reg_succ, rem_succ, req_item, res_item, rel_res, con_res, put_item, try_fwd_task
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+        , req_fwd
+#endif
     };
 
     // implements the aggregator_operation concept
@@ -1215,6 +1219,9 @@ protected:
             case con_res:  internal_consume(tmp); try_forwarding = true; break;
             case put_item: try_forwarding = internal_push(tmp); break;
             case try_fwd_task: internal_forward_task(tmp); break;
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+            case req_fwd: tmp->status.store(SUCCEEDED, std::memory_order_release); try_forwarding = true; break;
+#endif
             }
         }
 
@@ -1244,6 +1251,16 @@ protected:
         return op_data.ltask;
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    //! Makes the aggregator pick up the items staged by lock-free producers
+    graph_task *request_forwarding() {
+        buffer_operation op_data(req_fwd);
+        my_aggregator.execute(&op_data);
+        graph_task *ft = grab_forwarding_task(op_data);
+        return ft ? ft : SUCCESSFULLY_ENQUEUED;
+    }
+#endif
+
     inline bool enqueue_forwarding_task(buffer_operation &op_data) {
         graph_task *ft = grab_forwarding_task(op_data);
         if(ft) {
@@ -1589,12 +1606,18 @@ protected:
 };  // queue_node
 
 //! Forwards messages in sequence order
-template <typename T>
+/** With the lock_free_buffering policy, producers place the items whose tags are close to the next
+    expected one into a sequence-indexed ring without the node aggregator. */
+template <typename T, typename Policy = queueing>
     __TBB_requires(std::copyable<T>)
 class sequencer_node : public queue_node<T> {
     function_body< T, size_t > *my_sequencer;
     // my_sequencer should be a benign function and must be callable
     // from a parallel context.  Does this mean it needn't be reset?
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    typedef std::is_same<Policy, lock_free_buffering> is_lock_free;
+    typename std::conditional<is_lock_free::value, sequencer_ring<T>, null_item_staging>::type my_ring;
+#endif
 public:
     typedef T input_type;
     typedef T output_type;
@@ -1635,6 +1658,25 @@ protected:
     typedef typename buffer_node<T>::size_type size_type;
     typedef typename buffer_node<T>::buffer_operation sequencer_operation;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    template< typename R, typename B > friend class run_and_put_task;
+    template<typename X, typename Y> friend class broadcast_cache;
+    template<typename X, typename Y> friend class round_robin_cache;
+    graph_task *try_put_task(const T &t) override {
+        return try_put_task_impl(t, is_lock_free());
+    }
+
+    void handle_operations(sequencer_operation *op_list) override {
+        take_placed_items(is_lock_free());
+        queue_node<T>::handle_operations(op_list);
+    }
+
+    void reset_node(reset_flags f) override {
+        queue_node<T>::reset_node(f);
+        my_ring.reset();
+    }
+#endif
+
 private:
     bool internal_push(sequencer_operation *op) override {
         size_type tag = (*my_sequencer)(*(op->elem));
@@ -1645,6 +1687,19 @@ private:
             return false;
         }
 #endif
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+        op_stat res = FAILED;
+        if (!try_place_in_ring(tag, *(op->elem), res, is_lock_free())) {
+            res = place_at(tag, *(op->elem)) ? SUCCEEDED : FAILED;
+        }
+#else
+        const op_stat res = place_at(tag, *(op->elem)) ? SUCCEEDED : FAILED;
+#endif
+        op->status.store(res, std::memory_order_release);
+        return res ==SUCCEEDED;
+    }
+
+    bool place_at(size_type tag, const T& item) {
         // cannot modify this->my_tail now; the buffer would be inconsistent.
         size_t new_tail = (tag+1 > this->my_tail) ? tag+1 : this->my_tail;
 
@@ -1653,14 +1708,74 @@ private:
         }
         this->my_tail = new_tail;
 
-        const op_stat res = this->place_item(tag, *(op->elem)) ? SUCCEEDED : FAILED;
-        op->status.store(res, std::memory_order_release);
-        return res ==SUCCEEDED;
+        return this->place_item(tag, item);
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    typedef typename sequencer_ring<T>::place_status place_status;
+
+    graph_task *try_put_task_impl(const T &t, std::false_type) {
+        return queue_node<T>::try_put_task(t);
+    }
+
+    graph_task *try_put_task_impl(const T &t, std::true_type) {
+        switch (my_ring.try_place((*my_sequencer)(t), t)) {
+        case place_status::placed:
+            // The producer of the item at the head will request forwarding
+            return SUCCESSFULLY_ENQUEUED;
+        case place_status::placed_at_head:
+            return my_ring.request_forwarding() ? this->request_forwarding() : SUCCESSFULLY_ENQUEUED;
+        case place_status::duplicate:
+            return nullptr;
+        default:
+            // Too far ahead of the head; the aggregator keeps the item in the item buffer
+            return queue_node<T>::try_put_task(t);
+        }
     }
+
+    bool try_place_in_ring(size_type, const T&, op_stat&, std::false_type) {
+        return false;
+    }
+
+    bool try_place_in_ring(size_type tag, const T& item, op_stat& res, std::true_type) {
+        switch (my_ring.try_place(tag, item)) {
+        case place_status::out_of_window:
+            return false;
+        case place_status::duplicate:
+            res = FAILED;
+            return true;
+        default:
+            take_placed_items(std::true_type());
+            res = SUCCEEDED;
+            return true;
+        }
+    }
+
+    void take_placed_items(std::false_type) {}
+
+    //! Moves the contiguous items at the head of the ring to the item buffer
+    void take_placed_items(std::true_type) {
+        my_ring.withdraw_forwarding_request();
+        for (;;) {
+            if (my_ring.try_take([this](size_type tag, const T& item) { place_at(tag, item); })) {
+                continue;
+            }
+            const size_type tag = my_ring.head();
+            if (this->my_item_valid(tag)) {
+                // Was put while the ring window did not cover the tag
+                my_ring.skip();
+                continue;
+            }
+            break;
+        }
+    }
+#endif
 };  // sequencer_node
 
 //! Forwards messages in priority order
-template<typename T, typename Compare = std::less<T>>
+/** With the lock_free_buffering policy, producers stage the items without the node aggregator,
+    and the aggregator moves all the staged items to the heap before it serves any request. */
+template<typename T, typename Compare = std::less<T>, typename Policy = queueing>
 class priority_queue_node : public buffer_node<T> {
 public:
     typedef T input_type;
@@ -1700,18 +1815,33 @@ protected:
     void reset_node( reset_flags f) override {
         mark = 0;
         base_type::reset_node(f);
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+        my_staging.reset();
+#endif
     }
 
     typedef typename buffer_node<T>::size_type size_type;
     typedef typename buffer_node<T>::item_type item_type;
     typedef typename buffer_node<T>::buffer_operation prio_operation;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    template< typename R, typename B > friend class run_and_put_task;
+    template<typename X, typename Y> friend class broadcast_cache;
+    template<typename X, typename Y> friend class round_robin_cache;
+    graph_task *try_put_task(const T &t) override {
+        return try_put_task_impl(t, is_lock_free());
+    }
+#endif
+
     //! Tries to forward valid items to successors
     void internal_forward_task(prio_operation *op) override {
         this->internal_forward_task_impl(op, this);
     }
 
     void handle_operations(prio_operation *op_list) override {
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+        take_staged_items(is_lock_free());
+#endif
         this->handle_operations_impl(op_list, this);
     }
 
@@ -1788,6 +1918,27 @@ private:
 
     input_type reserved_item;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+    typedef std::is_same<Policy, lock_free_buffering> is_lock_free;
+    typename std::conditional<is_lock_free::value, sharded_item_staging<T>, null_item_staging>::type my_staging;
+
+    graph_task *try_put_task_impl(const T &t, std::false_type) {
+        return base_type::try_put_task(t);
+    }
+
+    graph_task *try_put_task_impl(const T &t, std::true_type) {
+        my_staging.push(t);
+        return my_staging.request_forwarding() ? this->request_forwarding() : SUCCESSFULLY_ENQUEUED;
+    }
+
+    void take_staged_items(std::false_type) {}
+
+    void take_staged_items(std::true_type) {
+        my_staging.withdraw_forwarding_request();
+        my_staging.take_all([this](const T& item) { prio_push(item); });
+    }
+#endif
+
     // in case a reheap has not been done after a push, check if the mark item is higher than the 0'th item
     bool prio_use_tail() {
         __TBB_ASSERT(mark <= this->my_tail, "mark outside bounds before test");
@@ -2898,11 +3049,18 @@ private:
         void reserve_wait() override {
             fgt_async_reserve(static_cast<typename async_node::receiver_type *>(my_node), &my_node->my_graph);
             my_node->my_graph.reserve_wait();
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+            my_node->my_in_flight.fetch_add(1);
+            my_node->start_polling();
+#endif
         }
 
         void release_wait() override {
             async_node* n = my_node;
             graph* g = &n->my_graph;
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+            n->my_in_flight.fetch_sub(1);
+#endif
             g->release_wait();
             fgt_async_commit(static_cast<typename async_node::receiver_type *>(n), g);
         }
@@ -2912,6 +3070,13 @@ private:
             return my_node->try_put_impl(i);
         }
 
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+        //! Implements gateway_type::try_put_batch for an external activity to submit messages to FG
+        std::size_t try_put_batch(const Output* first, std::size_t count) override {
+            return my_node->try_put_batch_impl(first, count);
+        }
+#endif
+
     private:
         async_node* my_node;
     } my_gateway;
@@ -2937,6 +3102,90 @@ private:
         return is_at_least_one_put_successful;
     }
 
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+    //! Puts a batch under a single lock of the successors and submits the resulting tasks at once
+    std::size_t try_put_batch_impl(const Output* first, std::size_t count) {
+        multifunction_output<Output> &port_0 = output_port<0>(*this);
+        broadcast_cache<output_type>& port_successors = port_0.successors();
+        fgt_async_try_put_begin(this, &port_0);
+        graph_task_list tasks;
+        const std::size_t accepted = port_successors.gather_successful_try_puts(first, count, tasks);
+        if (!tasks.empty()) {
+            graph_task& t = tasks.pop_front();
+            if (tasks.empty()) {
+                enqueue_in_graph_arena(this->my_graph, t);
+            } else {
+                tasks.push_back(t);
+                small_object_allocator allocator{};
+                graph_task* list_task = allocator.new_object<spawn_task_list_task>(this->my_graph, allocator, tasks);
+                this->my_graph.reserve_wait();
+                enqueue_in_graph_arena(this->my_graph, *list_task);
+            }
+        }
+        fgt_async_try_put_end(this, &port_0);
+        return accepted;
+    }
+
+    //! Polls the completion source installed by set_completion_poller
+    class completion_poller : no_copy {
+    public:
+        virtual ~completion_poller() {}
+        virtual std::size_t poll(gateway_type& gateway) = 0;
+    };
+
+    template <typename Poller>
+    class completion_poller_leaf : public completion_poller {
+    public:
+        completion_poller_leaf(const Poller& p) : my_poller(p) {}
+        std::size_t poll(gateway_type& gateway) override { return my_poller(gateway); }
+    private:
+        Poller my_poller;
+    };
+
+    friend class async_poll_task<async_node>;
+
+    //! Makes an arena thread poll while the gateway has outstanding reservations
+    void start_polling() {
+        if (my_poller && !my_polling.exchange(true)) {
+            schedule_poll();
+        }
+    }
+
+    void schedule_poll() {
+        if (!is_graph_active(this->my_graph)) {
+            my_polling.store(false);
+            return;
+        }
+        small_object_allocator allocator{};
+        graph_task* t = allocator.new_object<async_poll_task<async_node>>(this->my_graph, allocator, *this);
+        this->my_graph.reserve_wait();
+        enqueue_in_graph_arena(this->my_graph, *t);
+    }
+
+    void poll_completions() {
+        if (my_poller->poll(my_gateway) == 0) {
+            // Nothing completed; let other threads run before polling again
+            yield();
+        }
+        if (my_in_flight.load() == 0) {
+            my_polling.store(false);
+            // Pairs with reserve_wait: either it sees the cleared flag or the poll sees its reservation
+            if (my_in_flight.load() == 0 || my_polling.exchange(true)) {
+                return;
+            }
+        }
+        schedule_poll();
+    }
+
+    void cancel_polling() {
+        my_polling.store(false);
+    }
+
+    std::unique_ptr<completion_poller> my_poller;
+    std::atomic<std::size_t> my_in_flight{0};
+    std::atomic<bool> my_polling{false};
+#endif
+
 public:
     template<typename Body>
         __TBB_requires(async_node_body<Body, input_type, gateway_type>)
@@ -2988,6 +3237,16 @@ public:
         return my_gateway;
     }
 
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+    //! Installs a callable polled by an arena thread while the gateway has outstanding reservations
+    /** The poller is called as std::size_t(gateway_type&), submits the completed results through
+        the gateway and returns their number. Install it before the first reserve_wait. */
+    template <typename Poller>
+    void set_completion_poller(Poller poller) {
+        my_poller.reset(new completion_poller_leaf<Poller>(poller));
+    }
+#endif
+
     // Define sender< Output >
 
     //! Add a new successor to this node
@@ -3244,13 +3503,13 @@ inline void set_name(const queue_node<T>& node, const char *name) {
     fgt_node_desc(&node, name);
 }
 
-template <typename T>
-inline void set_name(const sequencer_node<T>& node, const char *name) {
+template <typename T, typename Policy>
+inline void set_name(const sequencer_node<T, Policy>& node, const char *name) {
     fgt_node_desc(&node, name);
 }
 
-template <typename T, typename Compare>
-inline void set_name(const priority_queue_node<T, Compare>& node, const char *name) {
+template <typename T, typename Compare, typename Policy>
+inline void set_name(const priority_queue_node<T, Compare, Policy>& node, const char *name) {
     fgt_node_desc(&node, name);
 }
 
@@ -17,6 +17,10 @@
 #ifndef __TBB_flow_graph_abstractions_H
 #define __TBB_flow_graph_abstractions_H
 
+#include "detail/_config.h"
+
+#include <cstddef>
+
 namespace tbb {
 namespace detail {
 namespace d1 {
@@ -41,6 +45,17 @@ public:
 
     //! Submit signal from an asynchronous activity to FG.
     virtual bool try_put(const input_type&) = 0;
+
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+    //! Submit a batch of signals; returns the number of signals accepted by FG.
+    virtual std::size_t try_put_batch(const input_type* first, std::size_t count) {
+        std::size_t accepted = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            accepted += try_put(first[i]) ? 1 : 0;
+        }
+        return accepted;
+    }
+#endif
 };
 
 } // d1
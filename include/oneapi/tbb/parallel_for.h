@@ -27,9 +27,17 @@
 #include "partitioner.h"
 #include "blocked_range.h"
 #include "task_group.h"
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+#include "task_arena.h"
+#include "tick_count.h"
+#endif
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <new>
+#include <type_traits>
+#include <utility>
 
 namespace tbb {
 namespace detail {
@@ -75,6 +83,11 @@ struct start_for : public task {
     task* cancel(execution_data&) override;
     void finalize(const execution_data&);
 
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+    static constexpr bool is_nothrow_body = std::is_nothrow_copy_constructible<Body>::value &&
+        noexcept(std::declval<const Body&>()(std::declval<Range&>()));
+#endif
+
     //! Constructor for root task.
     start_for( const Range& range, const Body& body, Partitioner& partitioner, small_object_allocator& alloc ) :
         my_range(range),
@@ -102,6 +115,14 @@ struct start_for : public task {
         my_partition.align_depth( d );
     }
     static void run(const Range& range, const Body& body, Partitioner& partitioner) {
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+        // The body cannot throw, so a nested loop can run in the context of the current task
+        if (is_nothrow_body && run_in_current_context([&](task_group_context& context) {
+                run(range, body, partitioner, context);
+            })) {
+            return;
+        }
+#endif
         task_group_context context(PARALLEL_FOR);
         run(range, body, partitioner, context);
     }
@@ -194,7 +215,9 @@ public:
     parallel_for_body_wrapper( const Function& _func, Index& _begin, Index& _step )
         : my_func(_func), my_begin(_begin), my_step(_step) {}
 
-    void operator()( const blocked_range<Index>& r ) const {
+    void operator()( const blocked_range<Index>& r ) const
+        noexcept(std::is_arithmetic<Index>::value && noexcept(std::declval<const Function&>()(std::declval<Index&>())))
+    {
         // A set of local variables to help the compiler with vectorization of the following loop.
         Index b = r.begin();
         Index e = r.end();
@@ -213,6 +236,109 @@ public:
     }
 };
 
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+//! Returns the number of items in the range if the range provides size(), and 1 otherwise
+template <typename Range>
+auto adaptive_range_size( const Range& range, int ) -> decltype(std::size_t(range.size())) {
+    return std::size_t(range.size());
+}
+
+template <typename Range>
+std::size_t adaptive_range_size( const Range&, ... ) {
+    return 1;
+}
+
+//! Time spent in the body and the threads that ran it during one parallel_for call
+class adaptive_for_trace : no_copy {
+    std::atomic<std::uint64_t> my_busy_ns{0};
+    std::atomic<std::uint64_t> my_threads{0};
+public:
+    void note(tick_count::interval_t busy_time) {
+        my_busy_ns.fetch_add(std::uint64_t(busy_time.seconds() * 1e9), std::memory_order_relaxed);
+        // Threads are told apart by their slot index modulo 64, which is enough for an estimate
+        int index = tbb::this_task_arena::current_thread_index();
+        std::uint64_t thread_bit = std::uint64_t(1) << (unsigned(index) % 64);
+        if (!(my_threads.load(std::memory_order_relaxed) & thread_bit)) {
+            my_threads.fetch_or(thread_bit, std::memory_order_relaxed);
+        }
+    }
+    double busy_time() const {
+        return double(my_busy_ns.load(std::memory_order_relaxed)) * 1e-9;
+    }
+    int num_threads() const {
+        int n = 0;
+        for (std::uint64_t mask = my_threads.load(std::memory_order_relaxed); mask; mask &= mask - 1) {
+            ++n;
+        }
+        return n > 0 ? n : 1;
+    }
+};
+
+//! Measures the time of the parallel_for body
+template <typename Body>
+class adaptive_for_body : no_assign {
+    const Body& my_body;
+    adaptive_for_trace& my_trace;
+public:
+    adaptive_for_body( const Body& body, adaptive_for_trace& trace ) : my_body(body), my_trace(trace) {}
+
+    template <typename Range>
+    void operator()( Range& range ) const noexcept(noexcept(std::declval<const Body&>()(std::declval<Range&>()))) {
+        tick_count start = tick_count::fast_now();
+        my_body(range);
+        my_trace.note(tick_count::fast_now() - start);
+    }
+};
+
+//! parallel_for with adaptive_partitioner
+/** Chooses the execution mode with the partitioner and feeds the measured times back to it. **/
+template <typename Range, typename Body>
+struct adaptive_for {
+    static void run( const Range& range, const Body& body, adaptive_partitioner& partitioner, task_group_context* context ) {
+        if (range.empty()) {
+            return;
+        }
+        const std::size_t items = adaptive_range_size(range, 0);
+        int awake_workers = 0;
+        const adaptive_partitioner::dispatch_mode mode = partitioner.choose(items, awake_workers);
+        if (mode == adaptive_partitioner::dispatch_mode::serial) {
+            if (context && context->is_group_execution_cancelled()) {
+                return;
+            }
+            Range r(range);
+            tick_count start = tick_count::fast_now();
+            body(r);
+            partitioner.note_work(items, (tick_count::fast_now() - start).seconds());
+            return;
+        }
+
+        adaptive_for_trace trace;
+        adaptive_for_body<Body> timed_body(body, trace);
+        tick_count start = tick_count::fast_now();
+        if (mode == adaptive_partitioner::dispatch_mode::awake_workers) {
+            limited_partitioner limited(std::size_t(awake_workers) + 1);
+            run_with(range, timed_body, limited, context);
+        } else {
+            const auto_partitioner automatic;
+            run_with(range, timed_body, automatic, context);
+        }
+        const double elapsed = (tick_count::fast_now() - start).seconds();
+        partitioner.note_work(items, trace.busy_time());
+        partitioner.note_dispatch(elapsed, trace.busy_time(), trace.num_threads());
+    }
+
+private:
+    template <typename Partitioner>
+    static void run_with( const Range& range, const adaptive_for_body<Body>& body, Partitioner& partitioner, task_group_context* context ) {
+        if (context) {
+            start_for<Range, adaptive_for_body<Body>, Partitioner>::run(range, body, partitioner, *context);
+        } else {
+            start_for<Range, adaptive_for_body<Body>, Partitioner>::run(range, body, partitioner);
+        }
+    }
+};
+#endif // __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+
 // Requirements on Range concept are documented in blocked_range.h
 
 /** \page parallel_for_body_req Requirements on parallel_for body
@@ -306,6 +432,24 @@ void parallel_for( const Range& range, const Body& body, affinity_partitioner& p
     start_for<Range,Body,affinity_partitioner>::run(range,body,partitioner, context);
 }
 
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+//! Parallel iteration over range with adaptive_partitioner.
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_for_body<Body, Range>)
+void parallel_for( const Range& range, const Body& body, adaptive_partitioner& partitioner ) {
+    adaptive_for<Range,Body>::run(range, body, partitioner, nullptr);
+}
+
+//! Parallel iteration over range with adaptive_partitioner and user-supplied context.
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_for_body<Body, Range>)
+void parallel_for( const Range& range, const Body& body, adaptive_partitioner& partitioner, task_group_context& context ) {
+    adaptive_for<Range,Body>::run(range, body, partitioner, &context);
+}
+#endif
+
 //! Implementation of parallel iteration over stepped range of integers with explicit step and partitioner
 template <typename Index, typename Function, typename Partitioner>
 void parallel_for_impl(Index first, Index last, Index step, const Function& f, Partitioner& partitioner) {
@@ -457,6 +601,33 @@ template <typename Index, typename Function>
 void parallel_for(Index first, Index last, const Function& f, affinity_partitioner& partitioner, task_group_context &context) {
     parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner, context);
 }
+
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+//! Parallel iteration over range of integers with explicit step and adaptive_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, Index step, const Function& f, adaptive_partitioner& partitioner) {
+    parallel_for_impl(first, last, step, f, partitioner);
+}
+//! Parallel iteration over range of integers with a default step value and adaptive_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, const Function& f, adaptive_partitioner& partitioner) {
+    parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner);
+}
+//! Parallel iteration over range of integers with explicit step, task group context, and adaptive_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, Index step, const Function& f, adaptive_partitioner& partitioner, task_group_context &context) {
+    parallel_for_impl(first, last, step, f, partitioner, context);
+}
+//! Parallel iteration over range of integers with a default step value, explicit task group context, and adaptive_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, const Function& f, adaptive_partitioner& partitioner, task_group_context &context) {
+    parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner, context);
+}
+#endif
 // @}
 
 } // namespace d1
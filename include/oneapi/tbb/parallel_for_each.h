@@ -122,14 +122,15 @@ struct feeder_item_task: public task {
     using feeder_type = feeder_impl<Body, Item>;
 
     template <typename ItemType>
-    feeder_item_task(ItemType&& input_item, feeder_type& feeder, small_object_allocator& alloc) :
+    feeder_item_task(ItemType&& input_item, feeder_type& feeder, reference_vertex& wait_vertex, small_object_allocator& alloc) :
         item(std::forward<ItemType>(input_item)),
         my_feeder(feeder),
+        my_wait_vertex(wait_vertex),
         my_allocator(alloc)
     {}
 
     void finalize(const execution_data& ed) {
-        my_feeder.my_wait_context.release();
+        my_wait_vertex.release();
         my_allocator.delete_object(this, ed);
     }
 
@@ -163,6 +164,7 @@ struct feeder_item_task: public task {
 
     Item item;
     feeder_type& my_feeder;
+    reference_vertex& my_wait_vertex;
     small_object_allocator my_allocator;
 }; // class feeder_item_task
 
@@ -174,9 +176,9 @@ class feeder_impl : public feeder<Item> {
     void internal_add_copy_impl(std::true_type, const Item& item) {
         using feeder_task = feeder_item_task<Body, Item>;
         small_object_allocator alloc;
-        auto task = alloc.new_object<feeder_task>(item, *this, alloc);
+        reference_vertex& wait_vertex = reserve_thread_reference_vertex(my_wait_context);
+        auto task = alloc.new_object<feeder_task>(item, *this, wait_vertex, alloc);
 
-        my_wait_context.reserve();
         spawn(*task, my_execution_context);
     }
 
@@ -191,9 +193,9 @@ class feeder_impl : public feeder<Item> {
     void internal_add_move(Item&& item) override {
         using feeder_task = feeder_item_task<Body, Item>;
         small_object_allocator alloc{};
-        auto task = alloc.new_object<feeder_task>(std::move(item), *this, alloc);
+        reference_vertex& wait_vertex = reserve_thread_reference_vertex(my_wait_context);
+        auto task = alloc.new_object<feeder_task>(std::move(item), *this, wait_vertex, alloc);
 
-        my_wait_context.reserve();
         spawn(*task, my_execution_context);
     }
 public:
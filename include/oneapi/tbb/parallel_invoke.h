@@ -28,6 +28,7 @@
 
 #include <tuple>
 #include <atomic>
+#include <type_traits>
 #include <utility>
 
 namespace tbb {
@@ -185,9 +186,24 @@ void parallel_invoke_impl(task_group_context& context, const Fs&... fs) {
     invoke_recursive_separation(root_wait_ctx, context, fs...);
 }
 
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+//! Checks that none of the functors passed to parallel_invoke can throw
+template <typename... Fs>
+using is_nothrow_invoke = conjunction<std::integral_constant<bool, noexcept(std::declval<const Fs&>()())>...>;
+#endif
+
 template<typename F1, typename... Fs>
 void parallel_invoke_impl(const F1& f1, const Fs&... fs) {
     static_assert(sizeof...(Fs) >= 1, "Parallel invoke may be called with at least two callable");
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+    // There are no exceptions to isolate if the functors cannot throw
+    if (is_nothrow_invoke<F1, Fs...>::value && run_in_current_context([&](task_group_context& context) {
+            wait_context root_wait_ctx{0};
+            invoke_recursive_separation(root_wait_ctx, context, fs..., f1);
+        })) {
+        return;
+    }
+#endif
     task_group_context context(PARALLEL_INVOKE);
     wait_context root_wait_ctx{0};
 
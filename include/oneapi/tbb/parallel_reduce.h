@@ -28,6 +28,9 @@
 #include "partitioner.h"
 #include "profiling.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace tbb {
 namespace detail {
 #if __TBB_CPP20_CONCEPTS_PRESENT
@@ -43,20 +46,38 @@ concept parallel_reduce_body = splittable<Body> &&
 template <typename Function, typename Range, typename Value>
 concept parallel_reduce_function = requires( const std::remove_reference_t<Function>& func,
                                              const Range& range,
-                                             const Value& value ) {
-    { func(range, value) } -> std::convertible_to<Value>;
+                                             Value&& value ) {
+    { func(range, std::move(value)) } -> std::convertible_to<Value>;
+} || requires( const std::remove_reference_t<Function>& func,
+               const Range& range,
+               Value& value ) {
+    { func(range, value) } -> std::same_as<void>;
 };
 
 template <typename Combine, typename Value>
 concept parallel_reduce_combine = requires( const std::remove_reference_t<Combine>& combine,
-                                            const Value& lhs, const Value& rhs ) {
-    { combine(lhs, rhs) } -> std::convertible_to<Value>;
+                                            Value&& lhs, Value&& rhs ) {
+    { combine(std::move(lhs), std::move(rhs)) } -> std::convertible_to<Value>;
+} || requires( const std::remove_reference_t<Combine>& combine,
+               Value& lhs, Value&& rhs ) {
+    { combine(lhs, std::move(rhs)) } -> std::same_as<void>;
 };
 
 } // namespace d0
 #endif // __TBB_CPP20_CONCEPTS_PRESENT
 namespace d1 {
 
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+//! Checks that neither splitting, accumulation nor joining of a reduction body can throw
+template <typename Range, typename Body>
+struct is_nothrow_reduce_body : std::integral_constant<bool,
+    std::is_nothrow_constructible<Body, Body&, detail::split>::value &&
+    std::is_nothrow_destructible<Body>::value &&
+    noexcept(std::declval<Body&>()(std::declval<Range&>())) &&
+    noexcept(std::declval<Body&>().join(std::declval<Body&>()))>
+{};
+#endif
+
 //! Tree node type for parallel_reduce.
 /** @ingroup algorithms */
 //TODO: consider folding tree via bypass execution(instead of manual folding)
@@ -143,6 +164,14 @@ struct start_reduce : public task {
         }
     }
     static void run(const Range& range, Body& body, Partitioner& partitioner) {
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+        // There are no exceptions to isolate if the body cannot throw
+        if (is_nothrow_reduce_body<Range, Body>::value && run_in_current_context([&](task_group_context& context) {
+                run(range, body, partitioner, context);
+            })) {
+            return;
+        }
+#endif
         // Bound context prevents exceptions from body to affect nesting or sibling algorithms,
         // and allows users to handle exceptions safely by wrapping parallel_reduce in the try-block.
         task_group_context context(PARALLEL_REDUCE);
@@ -288,6 +317,14 @@ struct start_deterministic_reduce : public task {
         }
     }
     static void run(const Range& range, Body& body, Partitioner& partitioner) {
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+        // There are no exceptions to isolate if the body cannot throw
+        if (is_nothrow_reduce_body<Range, Body>::value && run_in_current_context([&](task_group_context& context) {
+                run(range, body, partitioner, context);
+            })) {
+            return;
+        }
+#endif
         // Bound context prevents exceptions from body to affect nesting or sibling algorithms,
         // and allows users to handle exceptions safely by wrapping parallel_deterministic_reduce
         // in the try-block.
@@ -359,6 +396,28 @@ task* start_deterministic_reduce<Range, Body, Partitioner>::cancel(execution_dat
 }
 
 
+template <typename RealBody, typename Range, typename Value>
+using in_place_reduce_body_result = decltype(std::declval<const RealBody&>()(std::declval<Range&>(), std::declval<Value&>()));
+
+//! Checks if the body of the functional form accumulates into its argument instead of returning the new value
+template <typename RealBody, typename Range, typename Value, typename = void>
+struct is_in_place_reduce_body : std::false_type {};
+
+template <typename RealBody, typename Range, typename Value>
+struct is_in_place_reduce_body<RealBody, Range, Value, void_t<in_place_reduce_body_result<RealBody, Range, Value>>>
+    : std::is_void<in_place_reduce_body_result<RealBody, Range, Value>> {};
+
+template <typename Reduction, typename Value>
+using in_place_reduction_result = decltype(std::declval<const Reduction&>()(std::declval<Value&>(), std::declval<Value&&>()));
+
+//! Checks if the reduction of the functional form merges the right value into the left one instead of returning the result
+template <typename Reduction, typename Value, typename = void>
+struct is_in_place_reduction : std::false_type {};
+
+template <typename Reduction, typename Value>
+struct is_in_place_reduction<Reduction, Value, void_t<in_place_reduction_result<Reduction, Value>>>
+    : std::is_void<in_place_reduction_result<Reduction, Value>> {};
+
 //! Auxiliary class for parallel_reduce; for internal use only.
 /** The adaptor class that implements \ref parallel_reduce_body_req "parallel_reduce Body"
     using given \ref parallel_reduce_lambda_req "anonymous function objects".
@@ -374,6 +433,32 @@ class lambda_reduce_body {
     const Reduction& my_reduction;
     Value            my_value;
     lambda_reduce_body& operator= ( const lambda_reduce_body& other );
+
+    using in_place_body = is_in_place_reduce_body<RealBody, Range, Value>;
+    using in_place_reduction = is_in_place_reduction<Reduction, Value>;
+
+    // The accumulated value is moved through the user functions, so a large value is never copied
+    // except for the identity element of a new body
+    void accumulate( Range& range, /*in_place = */std::true_type )
+        noexcept(noexcept(std::declval<const RealBody&>()(std::declval<Range&>(), std::declval<Value&>())))
+    {
+        my_real_body(range, my_value);
+    }
+    void accumulate( Range& range, /*in_place = */std::false_type )
+        noexcept(noexcept(std::declval<Value&>() = std::declval<const RealBody&>()(std::declval<Range&>(), std::declval<Value&&>())))
+    {
+        my_value = my_real_body(range, std::move(my_value));
+    }
+    void combine( Value& rhs, /*in_place = */std::true_type )
+        noexcept(noexcept(std::declval<const Reduction&>()(std::declval<Value&>(), std::declval<Value&&>())))
+    {
+        my_reduction(my_value, std::move(rhs));
+    }
+    void combine( Value& rhs, /*in_place = */std::false_type )
+        noexcept(noexcept(std::declval<Value&>() = std::declval<const Reduction&>()(std::declval<Value&&>(), std::declval<Value&&>())))
+    {
+        my_value = my_reduction(std::move(my_value), std::move(rhs));
+    }
 public:
     lambda_reduce_body( const Value& identity, const RealBody& body, const Reduction& reduction )
         : my_identity_element(identity)
@@ -383,19 +468,24 @@ public:
     { }
     lambda_reduce_body( const lambda_reduce_body& other ) = default;
     lambda_reduce_body( lambda_reduce_body& other, tbb::split )
+        noexcept(std::is_nothrow_copy_constructible<Value>::value)
         : my_identity_element(other.my_identity_element)
         , my_real_body(other.my_real_body)
         , my_reduction(other.my_reduction)
         , my_value(other.my_identity_element)
     { }
-    void operator()(Range& range) {
-        my_value = my_real_body(range, const_cast<const Value&>(my_value));
+    void operator()(Range& range)
+        noexcept(noexcept(std::declval<lambda_reduce_body&>().accumulate(std::declval<Range&>(), in_place_body{})))
+    {
+        accumulate(range, in_place_body{});
     }
-    void join( lambda_reduce_body& rhs ) {
-        my_value = my_reduction(const_cast<const Value&>(my_value), const_cast<const Value&>(rhs.my_value));
+    void join( lambda_reduce_body& rhs )
+        noexcept(noexcept(std::declval<lambda_reduce_body&>().combine(std::declval<Value&>(), in_place_reduction{})))
+    {
+        combine(rhs.my_value, in_place_reduction{});
     }
-    Value result() const {
-        return my_value;
+    Value&& result() && noexcept {
+        return std::move(my_value);
     }
 };
 
@@ -512,7 +602,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const __TBB_DEFAULT_PARTITIONER>
                           ::run(range, body, __TBB_DEFAULT_PARTITIONER() );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction and simple_partitioner.
@@ -525,7 +615,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const simple_partitioner>
                           ::run(range, body, partitioner );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction and auto_partitioner
@@ -538,7 +628,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const auto_partitioner>
                           ::run( range, body, partitioner );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction and static_partitioner
@@ -551,7 +641,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const static_partitioner>
                                         ::run( range, body, partitioner );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction and affinity_partitioner
@@ -564,7 +654,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,affinity_partitioner>
                                         ::run( range, body, partitioner );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction, default partitioner and user-supplied context.
@@ -577,7 +667,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const __TBB_DEFAULT_PARTITIONER>
                           ::run( range, body, __TBB_DEFAULT_PARTITIONER(), context );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction, simple partitioner and user-supplied context.
@@ -590,7 +680,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const simple_partitioner>
                           ::run( range, body, partitioner, context );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction, auto_partitioner and user-supplied context
@@ -603,7 +693,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const auto_partitioner>
                           ::run( range, body, partitioner, context );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction, static_partitioner and user-supplied context
@@ -616,7 +706,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,const static_partitioner>
                                         ::run( range, body, partitioner, context );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with reduction, affinity_partitioner and user-supplied context
@@ -629,7 +719,7 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,affinity_partitioner>
                                         ::run( range, body, partitioner, context );
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with deterministic reduction and default simple partitioner.
@@ -702,7 +792,7 @@ Value parallel_deterministic_reduce( const Range& range, const Value& identity,
     lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
     start_deterministic_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>, const simple_partitioner>
                           ::run(range, body, partitioner);
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with deterministic reduction and static partitioner.
@@ -714,7 +804,7 @@ Value parallel_deterministic_reduce( const Range& range, const Value& identity,
     lambda_reduce_body<Range, Value, RealBody, Reduction> body(identity, real_body, reduction);
     start_deterministic_reduce<Range, lambda_reduce_body<Range, Value, RealBody, Reduction>, const static_partitioner>
         ::run(range, body, partitioner);
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with deterministic reduction, default simple partitioner and user-supplied context.
@@ -737,7 +827,7 @@ Value parallel_deterministic_reduce( const Range& range, const Value& identity,
     lambda_reduce_body<Range, Value, RealBody, Reduction> body(identity, real_body, reduction);
     start_deterministic_reduce<Range, lambda_reduce_body<Range, Value, RealBody, Reduction>, const simple_partitioner>
         ::run(range, body, partitioner, context);
-    return body.result();
+    return std::move(body).result();
 }
 
 //! Parallel iteration with deterministic reduction, static partitioner and user-supplied context.
@@ -750,7 +840,7 @@ Value parallel_deterministic_reduce( const Range& range, const Value& identity,
     lambda_reduce_body<Range, Value, RealBody, Reduction> body(identity, real_body, reduction);
     start_deterministic_reduce<Range, lambda_reduce_body<Range, Value, RealBody, Reduction>, const static_partitioner>
         ::run(range, body, partitioner, context);
-    return body.result();
+    return std::move(body).result();
 }
 //@}
 
@@ -0,0 +1,352 @@
+/*
+    Copyright (c) 2005-2021 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB_parallel_region_H
+#define __TBB_parallel_region_H
+
+#if ! TBB_PREVIEW_PARALLEL_REGION
+    #error Set TBB_PREVIEW_PARALLEL_REGION to include parallel_region.h
+#endif
+
+#include "detail/_config.h"
+#include "detail/_namespace_injection.h"
+#include "detail/_assert.h"
+#include "detail/_exception.h"
+#include "detail/_task.h"
+#include "detail/_utils.h"
+#include "detail/_small_object_pool.h"
+
+#include "blocked_range.h"
+#include "cache_aligned_allocator.h"
+#include "task_arena.h"
+#include "task_group.h"
+#include "tick_count.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+
+namespace tbb {
+namespace detail {
+namespace d1 {
+
+//! Shared state of a parallel region
+/** Holds the membership gate, a combining tree barrier and the per-member work cursors.
+    All the fields touched by more than one member live in separate cache lines. **/
+class parallel_region_state : no_copy {
+public:
+    //! Arity of the barrier tree
+    static constexpr int barrier_arity = 4;
+
+    //! Time the leader waits for the spawned members to join the region
+    static constexpr double join_grace_period = 1e-3;
+
+    explicit parallel_region_state(int capacity) :
+        my_capacity(capacity),
+        my_slots(cache_aligned_allocator<slot>().allocate(capacity))
+    {
+        __TBB_ASSERT(capacity > 0, nullptr);
+        for (int i = 0; i < capacity; ++i) {
+            new (my_slots + i) slot();
+        }
+    }
+
+    ~parallel_region_state() {
+        cache_aligned_allocator<slot>().deallocate(my_slots, my_capacity);
+    }
+
+    //! Admits the calling thread to the region
+    /** Returns the index of the new member or -1 if the membership is already closed. **/
+    int join() {
+        int joined = my_joined.load(std::memory_order_relaxed);
+        do {
+            if (joined & closed_flag) {
+                return -1;
+            }
+        } while (!my_joined.compare_exchange_weak(joined, joined + 1));
+        return joined;
+    }
+
+    //! Waits until either all the expected members join or the grace period expires, then closes the membership
+    void close(int expected) {
+        const tick_count start = tick_count::now();
+        for (atomic_backoff backoff; my_joined.load(std::memory_order_acquire) < expected; backoff.pause()) {
+            if ((tick_count::now() - start).seconds() > join_grace_period) {
+                break;
+            }
+        }
+        my_joined.fetch_or(closed_flag);
+    }
+
+    //! Waits until the membership is closed and returns the number of members
+    int size() const {
+        int joined = my_joined.load(std::memory_order_acquire);
+        for (atomic_backoff backoff; !(joined & closed_flag); backoff.pause()) {
+            joined = my_joined.load(std::memory_order_acquire);
+        }
+        return joined & ~closed_flag;
+    }
+
+    //! Blocks until all the members arrive; throws region_abort if the region is aborted
+    void barrier(int index, int size, std::uintptr_t& phase) {
+        const std::uintptr_t next_phase = phase + 1;
+        // Gather the arrivals of the subtree rooted at this member
+        const int first_child = index * barrier_arity + 1;
+        const int last_child = std::min(first_child + barrier_arity, size);
+        for (int child = first_child; child < last_child; ++child) {
+            wait_while([&] { return my_slots[child].arrived.load(std::memory_order_acquire) != next_phase; });
+        }
+        if (index == 0) {
+            my_phase.store(next_phase, std::memory_order_release);
+        } else {
+            my_slots[index].arrived.store(next_phase, std::memory_order_release);
+            wait_while([&] { return my_phase.load(std::memory_order_acquire) != next_phase; });
+        }
+        phase = next_phase;
+    }
+
+    //! Advances the work cursor of the member to the new phase
+    void start_work(int index, std::uint64_t tag) {
+        my_slots[index].cursor.store(tag, std::memory_order_release);
+    }
+
+    //! Claims the next chunk of the block owned by the given member
+    /** Returns false if the block is exhausted or not yet started in this phase. **/
+    bool claim_work(int owner, std::uint64_t tag, std::size_t length, std::size_t chunk, std::size_t& offset) {
+        std::atomic<std::uint64_t>& cursor = my_slots[owner].cursor;
+        if ((cursor.load(std::memory_order_acquire) & ~offset_mask) != tag) {
+            return false;
+        }
+        offset = std::size_t(cursor.fetch_add(chunk, std::memory_order_relaxed) & offset_mask);
+        return offset < length;
+    }
+
+    //! Marks the region as failed and wakes up the members waiting at the barrier
+    void abort() {
+#if TBB_USE_EXCEPTIONS
+        if (!my_aborted.exchange(true)) {
+            my_exception = std::current_exception();
+        }
+#else
+        my_aborted.store(true, std::memory_order_release);
+#endif
+    }
+
+    //! Rethrows the exception that aborted the region, if any
+    void rethrow_if_aborted() {
+#if TBB_USE_EXCEPTIONS
+        if (my_exception) {
+            std::rethrow_exception(my_exception);
+        }
+#endif
+    }
+
+    //! Internal exception type unwinding the members of an aborted region
+    struct region_abort {};
+
+    //! Number of bits of a work cursor holding the offset within the block
+    static constexpr unsigned offset_bits = 40;
+    static constexpr std::uint64_t offset_mask = (std::uint64_t(1) << offset_bits) - 1;
+
+private:
+    static constexpr int closed_flag = 1 << 30;
+
+    struct alignas(max_nfs_size) slot {
+        //! Last barrier phase the subtree of the member arrived to
+        std::atomic<std::uintptr_t> arrived{0};
+        //! Work phase tag in the high bits and the next unclaimed offset of the block in the low bits
+        std::atomic<std::uint64_t> cursor{0};
+    };
+
+    template <typename Condition>
+    void wait_while(const Condition& condition) {
+        for (atomic_backoff backoff; condition(); backoff.pause()) {
+            if (my_aborted.load(std::memory_order_acquire)) {
+#if TBB_USE_EXCEPTIONS
+                throw region_abort{};
+#else
+                return;
+#endif
+            }
+        }
+    }
+
+    const int my_capacity;
+    slot* const my_slots;
+    alignas(max_nfs_size) std::atomic<int> my_joined{1};
+    alignas(max_nfs_size) std::atomic<std::uintptr_t> my_phase{0};
+    alignas(max_nfs_size) std::atomic<bool> my_aborted{false};
+#if TBB_USE_EXCEPTIONS
+    std::exception_ptr my_exception;
+#endif
+};
+
+//! Handle of a thread participating in a parallel region
+/** Passed to the region body on each member thread. The members execute the body in a SPMD fashion,
+    so every member must perform the same sequence of barrier and parallel_for calls. **/
+class parallel_region_member : no_copy {
+public:
+    //! Index of the member in [0, size())
+    int index() const { return my_index; }
+
+    //! Number of the members in the region
+    int size() const { return my_size; }
+
+    //! Blocks until all the members of the region call barrier
+    void barrier() {
+        my_state.barrier(my_index, my_size, my_barrier_phase);
+    }
+
+    //! Splits the range among the members and waits for its completion
+    /** Each member starts with its own contiguous block, then steals chunks from the blocks
+        of the other members. The call completes with an implicit barrier. **/
+    template <typename Value, typename Body>
+    void parallel_for(const blocked_range<Value>& range, const Body& body) {
+        static_assert(std::is_integral<Value>::value, "parallel_region_member::parallel_for requires an integral range");
+        const std::size_t n = range.size();
+        __TBB_ASSERT(n <= (parallel_region_state::offset_mask >> 1), "The range is too large");
+        const std::uint64_t tag = ++my_work_phase << parallel_region_state::offset_bits;
+        my_state.start_work(my_index, tag);
+        for (int k = 0; k < my_size; ++k) {
+            const int owner = (my_index + k) % my_size;
+            const std::size_t first = block_begin(n, owner);
+            const std::size_t length = block_begin(n, owner + 1) - first;
+            const std::size_t chunk = std::max(range.grainsize(), length / chunks_per_block);
+            std::size_t offset = 0;
+            while (my_state.claim_work(owner, tag, length, chunk, offset)) {
+                const Value begin = static_cast<Value>(range.begin() + static_cast<Value>(first + offset));
+                const Value end = static_cast<Value>(begin + static_cast<Value>(std::min(chunk, length - offset)));
+                body(blocked_range<Value>(begin, end));
+            }
+        }
+        barrier();
+    }
+
+private:
+    //! Number of chunks a block is divided into for stealing
+    static constexpr std::size_t chunks_per_block = 8;
+
+    parallel_region_member(parallel_region_state& state, int index, int size) :
+        my_state(state), my_index(index), my_size(size)
+    {}
+
+    std::size_t block_begin(std::size_t n, int member) const {
+        const std::size_t m = std::size_t(member);
+        return m * (n / std::size_t(my_size)) + std::min(m, n % std::size_t(my_size));
+    }
+
+    parallel_region_state& my_state;
+    const int my_index;
+    const int my_size;
+    std::uintptr_t my_barrier_phase{0};
+    std::uint64_t my_work_phase{0};
+
+    template <typename Body>
+    friend void run_region_member(parallel_region_state&, int, const Body&);
+};
+
+template <typename Body>
+void run_region_member(parallel_region_state& state, int index, const Body& body) {
+    parallel_region_member member(state, index, state.size());
+    // Nested waits inside the body must not pick up the members of other regions
+    this_task_arena::isolate([&] {
+#if TBB_USE_EXCEPTIONS
+        try {
+            body(member);
+        } catch (const parallel_region_state::region_abort&) {
+            // Another member has failed
+        } catch (...) {
+            state.abort();
+        }
+#else
+        body(member);
+#endif
+    });
+}
+
+//! Task bringing a worker thread into a parallel region
+template <typename Body>
+class region_member_task : public task {
+public:
+    region_member_task(parallel_region_state& state, const Body& body, wait_context& wait_ctx, small_object_allocator& alloc) :
+        my_state(state), my_body(body), my_wait_context(wait_ctx), my_allocator(alloc)
+    {}
+
+private:
+    task* execute(execution_data& ed) override {
+        const int index = my_state.join();
+        if (index >= 0) {
+            run_region_member(my_state, index, my_body);
+        }
+        finalize(ed);
+        return nullptr;
+    }
+
+    task* cancel(execution_data& ed) override {
+        finalize(ed);
+        return nullptr;
+    }
+
+    void finalize(const execution_data& ed) {
+        wait_context& wait_ctx = my_wait_context;
+        my_allocator.delete_object(this, ed);
+        wait_ctx.release();
+    }
+
+    parallel_region_state& my_state;
+    const Body& my_body;
+    wait_context& my_wait_context;
+    small_object_allocator my_allocator;
+};
+
+//! Runs the body on the calling thread and on the arena threads available within a short grace period
+/** The members stay in the region until the body completes, so consecutive phases separated by
+    barriers avoid the task creation, the wake-ups and the join of separate parallel algorithms. **/
+template <typename Body>
+void parallel_region(const Body& body) {
+    const int capacity = this_task_arena::max_concurrency();
+    parallel_region_state state(capacity);
+    if (capacity > 1) {
+        task_group_context context(ALGORITHM);
+        wait_context wait_ctx(capacity - 1);
+        for (int i = 1; i < capacity; ++i) {
+            small_object_allocator alloc{};
+            spawn(*alloc.new_object<region_member_task<Body>>(state, body, wait_ctx, alloc), context);
+        }
+        state.close(capacity);
+        run_region_member(state, 0, body);
+        wait(wait_ctx, context);
+    } else {
+        state.close(capacity);
+        run_region_member(state, 0, body);
+    }
+    state.rethrow_if_aborted();
+}
+
+} // namespace d1
+} // namespace detail
+
+inline namespace v1 {
+using detail::d1::parallel_region;
+using detail::d1::parallel_region_member;
+} // namespace v1
+
+} // namespace tbb
+
+#endif /* __TBB_parallel_region_H */
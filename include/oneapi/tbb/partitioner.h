@@ -67,6 +67,10 @@ class static_partitioner;
 class affinity_partitioner;
 class affinity_partition_type;
 class affinity_partitioner_base;
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+class limited_partitioner;
+class adaptive_partitioner;
+#endif
 
 inline std::size_t get_initial_auto_partitioner_divisor() {
     const std::size_t factor = 4;
@@ -525,6 +529,20 @@ public:
         : linear_affinity_mode<static_partition_type>(p, split_obj) {}
 };
 
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+//! Splits the range into a given number of chunks that are spawned without affinity
+class limited_partition_type : public proportional_mode<limited_partition_type> {
+public:
+    typedef detail::proportional_split split_type;
+    limited_partition_type( const limited_partitioner& lp );
+    limited_partition_type( limited_partition_type& p, const proportional_split& split_obj )
+        : proportional_mode<limited_partition_type>(p, split_obj) {}
+    void spawn_task(task& t, task_group_context& ctx) {
+        spawn(t, ctx);
+    }
+};
+#endif // __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+
 class affinity_partition_type : public dynamic_grainsize_mode<linear_affinity_mode<affinity_partition_type> > {
     static const unsigned factor_power = 4; // TODO: get a unified formula based on number of computing units
     slot_id* my_array;
@@ -654,6 +672,113 @@ private:
     typedef affinity_partition_type::split_type split_type;
 };
 
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+//! A partitioner that runs the range on a given number of threads at most
+/** Used by adaptive_partitioner to share the work only with the threads already in the arena. **/
+class limited_partitioner {
+public:
+    explicit limited_partitioner( std::size_t max_chunks ) : my_max_chunks(max_chunks) {}
+private:
+    template<typename Range, typename Body, typename Partitioner> friend struct start_for;
+    friend class limited_partition_type;
+    typedef limited_partition_type task_partition_type;
+    typedef limited_partition_type::split_type split_type;
+
+    std::size_t my_max_chunks;
+};
+
+inline limited_partition_type::limited_partition_type( const limited_partitioner& lp ) {
+    my_divisor = lp.my_max_chunks;
+}
+
+//! An adaptive partitioner
+/** Chooses for each call whether to run the range serially in the calling thread, to share it
+    only with the workers that are already awake in the arena, or to run it fully in parallel.
+    The choice is based on the duration of the body and of the parallel dispatch measured by the
+    previous calls that used the same partitioner object.
+    @ingroup algorithms */
+class adaptive_partitioner : no_copy {
+public:
+    adaptive_partitioner() {}
+
+private:
+    template<typename Range, typename Body> friend struct adaptive_for;
+
+    enum class dispatch_mode {
+        serial,        // run the body in the calling thread
+        awake_workers, // share the work with the workers that are in the arena already
+        parallel       // run with auto_partitioner waking up workers if necessary
+    };
+
+    //! Weight of the last measurement in the running averages, as a power of two
+    static constexpr int history_shift = 2;
+    //! Serial calls with work comparable to the dispatch time after which the dispatch is measured again
+    static constexpr unsigned remeasure_period = 256;
+    //! Work below dispatch time / remeasure_ratio never leads to measuring the dispatch again
+    static constexpr double remeasure_ratio = 16;
+
+    dispatch_mode choose(std::size_t items, int& awake_workers) {
+        const int concurrency = max_concurrency();
+        if (concurrency <= 1) {
+            return dispatch_mode::serial;
+        }
+        if (my_item_time <= 0 || my_dispatch_time <= 0) {
+            // Nothing is known about the body or the dispatch yet
+            return dispatch_mode::parallel;
+        }
+        const double work = my_item_time * double(items);
+        if (work <= my_dispatch_time) {
+            // The dispatch time may be overestimated, e.g. by the creation of worker threads
+            // during the first call, so check it from time to time if the decision is not obvious
+            if (work * remeasure_ratio > my_dispatch_time && ++my_serial_calls % remeasure_period == 0) {
+                return dispatch_mode::parallel;
+            }
+            return dispatch_mode::serial;
+        }
+        if (work <= my_dispatch_time * double(concurrency)) {
+            // Waking up the sleeping workers costs more than their help
+            awake_workers = r1::active_workers(nullptr);
+            return awake_workers > 0 ? dispatch_mode::awake_workers : dispatch_mode::serial;
+        }
+        return dispatch_mode::parallel;
+    }
+
+    static double update(double average, double sample) {
+        return average <= 0 ? sample : average + (sample - average) / (1 << history_shift);
+    }
+
+    //! Records the time of the body for the given number of items
+    void note_work(std::size_t items, double busy_time) {
+        if (items > 0) {
+            my_item_time = update(my_item_time, busy_time / double(items));
+        }
+    }
+
+    //! Records the time of a call executed by several threads
+    /** The dispatch time is the part of the elapsed time that is not explained by
+        the work of the body shared evenly between the participating threads. **/
+    void note_dispatch(double elapsed_time, double busy_time, int num_threads) {
+        __TBB_ASSERT(num_threads > 0, nullptr);
+        if (!my_warmed_up) {
+            // The first call may include the creation of worker threads
+            my_warmed_up = true;
+            return;
+        }
+        double overhead = elapsed_time - busy_time / num_threads;
+        my_dispatch_time = update(my_dispatch_time, overhead > 0 ? overhead : 0);
+    }
+
+    //! Running average of the body time per range item, in seconds
+    double my_item_time{0};
+    //! Running average of the time to start and finish a parallel call, in seconds
+    double my_dispatch_time{0};
+    //! Number of serial calls that might have been worth running in parallel
+    unsigned my_serial_calls{0};
+    //! Whether the dispatch time of the first call was skipped
+    bool my_warmed_up{false};
+};
+#endif // __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+
 } // namespace d1
 } // namespace detail
 
@@ -663,6 +788,9 @@ using detail::d1::auto_partitioner;
 using detail::d1::simple_partitioner;
 using detail::d1::static_partitioner;
 using detail::d1::affinity_partitioner;
+#if __TBB_PREVIEW_ADAPTIVE_PARTITIONER
+using detail::d1::adaptive_partitioner;
+#endif
 // Split types
 using detail::split;
 using detail::proportional_split;
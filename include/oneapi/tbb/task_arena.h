@@ -90,6 +90,7 @@ TBB_EXPORT bool __TBB_EXPORTED_FUNC attach(d1::task_arena_base&);
 TBB_EXPORT void __TBB_EXPORTED_FUNC execute(d1::task_arena_base&, d1::delegate_base&);
 TBB_EXPORT void __TBB_EXPORTED_FUNC wait(d1::task_arena_base&);
 TBB_EXPORT int  __TBB_EXPORTED_FUNC max_concurrency(const d1::task_arena_base*);
+TBB_EXPORT int  __TBB_EXPORTED_FUNC active_workers(const d1::task_arena_base*);
 TBB_EXPORT void __TBB_EXPORTED_FUNC isolate_within_arena(d1::delegate_base& d, std::intptr_t);
 
 TBB_EXPORT void __TBB_EXPORTED_FUNC enqueue(d1::task&, d1::task_arena_base*);
@@ -104,7 +105,9 @@ inline void enqueue_impl(task_handle&& th, d1::task_arena_base* ta) {
     auto& ctx = task_handle_accessor::ctx_of(th);
 
     // Do not access th after release
-    r1::enqueue(*task_handle_accessor::release(th), ctx, ta);
+    if (d1::task* t = task_handle_accessor::release(th)) {
+        r1::enqueue(*t, ctx, ta);
+    }
 }
 } //namespace d2
 
@@ -31,6 +31,7 @@
 #include "profiling.h"
 
 #include <type_traits>
+#include <thread>
 
 #if _MSC_VER && !defined(__INTEL_COMPILER)
     // Suppress warning: structure was padded due to alignment specifier
@@ -87,17 +88,28 @@ class function_task : public task_handle_task  {
 private:
     d1::task* execute(d1::execution_data& ed) override {
         __TBB_ASSERT(ed.context == &this->ctx(), "The task group context should be used for all tasks");
-        task* res = task_ptr_or_nullptr(m_func);
+#if __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
+        task* res = nullptr;
+        {
+            // The body may transfer the completion of this task to another one
+            current_task_guard guard{this};
+            res = task_ptr_or_nullptr(m_func);
+        }
+        res = complete(res, ed);
+#else
+        task* res = complete(task_ptr_or_nullptr(m_func), ed);
+#endif
         finalize(&ed);
         return res;
     }
     d1::task* cancel(d1::execution_data& ed) override {
+        task* res = complete(nullptr, ed);
         finalize(&ed);
-        return nullptr;
+        return res;
     }
 public:
     template<typename FF>
-    function_task(FF&& f, d1::wait_context& wo, d1::task_group_context& ctx, d1::small_object_allocator& alloc)
+    function_task(FF&& f, d1::wait_reference wo, d1::task_group_context& ctx, d1::small_object_allocator& alloc)
         : task_handle_task{wo, ctx, alloc},
           m_func(std::forward<FF>(f)) {}
 };
@@ -134,6 +146,16 @@ namespace {
     }
 }  // namespace
 #endif // __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
+
+#if __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
+//! Makes the successor task wait for the completion of the predecessor task
+/** Both tasks must be created by the same task_group and must not be submitted yet.
+    The successor starts when all its predecessors complete and it is submitted. **/
+inline void make_edge(task_handle& predecessor, task_handle& successor) {
+    __TBB_ASSERT(predecessor != nullptr && successor != nullptr, "Attempt to make an edge with empty task_handle");
+    task_handle_accessor::get(predecessor)->add_successor(*task_handle_accessor::get(successor));
+}
+#endif // __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
 } // namespace d2
 
 namespace d1 {
@@ -415,6 +437,10 @@ private:
     friend struct r1::task_arena_impl;
     friend struct r1::task_group_context_impl;
     friend class task_group_base;
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+    template <typename F>
+    friend bool run_in_current_context(const F& f);
+#endif
 }; // class task_group_context
 
 static_assert(sizeof(task_group_context) == 128, "Wrong size of task_group_context");
@@ -434,12 +460,12 @@ class isolated_task_group;
 template<typename F>
 class function_task : public task {
     const F m_func;
-    wait_context& m_wait_ctx;
+    wait_reference m_wait_ref;
     small_object_allocator m_allocator;
 
     void finalize(const execution_data& ed) {
-        // Make a local reference not to access this after destruction.
-        wait_context& wo = m_wait_ctx;
+        // Make a local copy not to access this after destruction.
+        wait_reference wo = m_wait_ref;
         // Copy allocator to the stack
         auto allocator = m_allocator;
         // Destroy user functor before release wait.
@@ -458,14 +484,14 @@ class function_task : public task {
         return nullptr;
     }
 public:
-    function_task(const F& f, wait_context& wo, small_object_allocator& alloc)
+    function_task(const F& f, wait_reference wo, small_object_allocator& alloc)
         : m_func(f)
-        , m_wait_ctx(wo)
+        , m_wait_ref(wo)
         , m_allocator(alloc) {}
 
-    function_task(F&& f, wait_context& wo, small_object_allocator& alloc)
+    function_task(F&& f, wait_reference wo, small_object_allocator& alloc)
         : m_func(std::move(f))
-        , m_wait_ctx(wo)
+        , m_wait_ref(wo)
         , m_allocator(alloc) {}
 };
 
@@ -494,6 +520,7 @@ class task_group_base : no_copy {
 protected:
     wait_context m_wait_ctx;
     task_group_context m_context;
+    std::thread::id m_owner{std::this_thread::get_id()};
 
     template<typename F>
     task_group_status internal_run_and_wait(const F& f) {
@@ -518,7 +545,12 @@ protected:
 
         bool cancellation_status = false;
         try_call([&] {
-            execute_and_wait(*acs::release(h), context(), m_wait_ctx, context());
+            // The task with unfinished predecessors is started by the last of them
+            if (task* t = acs::release(h)) {
+                execute_and_wait(*t, context(), m_wait_ctx, context());
+            } else {
+                d1::wait(m_wait_ctx, context());
+            }
         }).on_completion([&] {
             // TODO: the reset method is not thread-safe. Ensure the correct behavior.
             cancellation_status = context().is_group_execution_cancelled();
@@ -527,11 +559,23 @@ protected:
         return cancellation_status ? canceled : complete;
     }
 
+    //! Accounts a new task in m_wait_ctx
+    /** The thread that created the group usually waits for it, so it refers the wait context
+        directly. Other threads account their tasks in per-thread reference vertices not to
+        contend on the reference counter of the group. **/
+    wait_reference reserve_wait_reference() {
+        if (std::this_thread::get_id() == m_owner) {
+            m_wait_ctx.reserve();
+            return wait_reference{m_wait_ctx};
+        }
+        return wait_reference{m_wait_ctx, &reserve_thread_reference_vertex(m_wait_ctx)};
+    }
+
     template<typename F>
     task* prepare_task(F&& f) {
-        m_wait_ctx.reserve();
+        wait_reference wo = reserve_wait_reference();
         small_object_allocator alloc{};
-        return alloc.new_object<function_task<typename std::decay<F>::type>>(std::forward<F>(f), m_wait_ctx, alloc);
+        return alloc.new_object<function_task<typename std::decay<F>::type>>(std::forward<F>(f), wo, alloc);
     }
 
     task_group_context& context() noexcept {
@@ -540,10 +584,10 @@ protected:
 
     template<typename F>
     d2::task_handle prepare_task_handle(F&& f) {
-        m_wait_ctx.reserve();
+        wait_reference wo = reserve_wait_reference();
         small_object_allocator alloc{};
         using function_task_t =  d2::function_task<typename std::decay<F>::type>;
-        d2::task_handle_task* function_task_p =  alloc.new_object<function_task_t>(std::forward<F>(f), m_wait_ctx, context(), alloc);
+        d2::task_handle_task* function_task_p =  alloc.new_object<function_task_t>(std::forward<F>(f), wo, context(), alloc);
 
         return d2::task_handle_accessor::construct(function_task_p);
     }
@@ -609,7 +653,9 @@ public:
         using acs = d2::task_handle_accessor;
         __TBB_ASSERT(&acs::ctx_of(h) == &context(), "Attempt to schedule task_handle into different task_group");
 
-        spawn(*acs::release(h), context());
+        if (task* t = acs::release(h)) {
+            spawn(*t, context());
+        }
     }
 
     template<typename F>
@@ -626,6 +672,20 @@ public:
     task_group_status run_and_wait(d2::task_handle&& h) {
         return internal_run_and_wait(std::move(h));
     }
+
+#if __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
+    //! Makes the successors of the executing task wait for the task of h instead
+    /** Lets a task finish without waiting for the tasks it creates, e.g. for joins in
+        recursive algorithms. Must be called from the body of a task created with defer. **/
+    static void transfer_this_task_completion_to(d2::task_handle& h) {
+        __TBB_ASSERT(h != nullptr, "Attempt to transfer completion to empty task_handle");
+        d2::task_handle_task* current = d2::current_task_handle_task();
+        __TBB_ASSERT(current != nullptr, "The completion can be transferred only from a task created with defer");
+        if (current) {
+            current->transfer_successors_to(*d2::task_handle_accessor::get(h));
+        }
+    }
+#endif
 }; // class task_group
 
 #if TBB_PREVIEW_ISOLATED_TASK_GROUP
@@ -633,7 +693,9 @@ class spawn_delegate : public delegate_base {
     task* task_to_spawn;
     task_group_context& context;
     bool operator()() const override {
-        spawn(*task_to_spawn, context);
+        if (task_to_spawn) {
+            spawn(*task_to_spawn, context);
+        }
         return true;
     }
 public:
@@ -716,6 +778,37 @@ inline bool is_current_task_group_canceling() {
     return ctx ? ctx->is_group_execution_cancelled() : false;
 }
 
+#if __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+//! Runs f(context) in the context of the currently executing task instead of a new bound one.
+/** Used by algorithms whose user code cannot throw: such an algorithm neither needs its own
+    exception storage nor its own registration in the context tree, and it is cancelled together
+    with the enclosing group anyway. Only bound contexts are shared; the default context of an
+    arena and isolated contexts must not see cancellations caused by nested algorithms.
+    Returns false if there is no context to share (e.g. at the outermost level). **/
+template <typename F>
+bool run_in_current_context(const F& f) {
+    task_group_context* current = current_context();
+    if (current == nullptr || !current->actual_context().my_traits.bound) {
+        return false;
+    }
+    task_group_context& context = current->actual_context();
+#if TBB_USE_EXCEPTIONS
+    try {
+        f(context);
+    } catch (...) {
+        // An exception registered in the shared context (e.g. std::bad_alloc thrown by a task of
+        // the algorithm) has canceled the enclosing group and is rethrown by its wait.
+        if (!context.is_group_execution_cancelled()) {
+            throw;
+        }
+    }
+#else
+    f(context);
+#endif
+    return true;
+}
+#endif // __TBB_PREVIEW_NOEXCEPT_ALGORITHMS
+
 } // namespace d1
 } // namespace detail
 
@@ -735,6 +828,9 @@ using detail::d1::is_current_task_group_canceling;
 using detail::r1::missing_wait;
 
 using detail::d2::task_handle;
+#if __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
+using detail::d2::make_edge;
+#endif
 }
 
 } // namespace tbb
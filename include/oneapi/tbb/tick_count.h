@@ -18,11 +18,20 @@
 #define __TBB_tick_count_H
 
 #include <chrono>
+#include <cstdint>
 
 #include "detail/_namespace_injection.h"
+#include "detail/_export.h"
+#include "detail/_machine.h"
 
 namespace tbb {
 namespace detail {
+namespace r1 {
+//! Returns the frequency of the invariant time stamp counter in ticks per second
+/** Returns zero if the time stamp counter cannot be used for timing. **/
+TBB_EXPORT std::uint64_t __TBB_EXPORTED_FUNC time_stamp_frequency();
+} // namespace r1
+
 namespace d1 {
 
 
@@ -72,6 +81,22 @@ public:
         return clock_type::now();
     }
 
+    //! Return current time read from the time stamp counter of the processor
+    /** The counter is calibrated against clock_type, so the result can be compared with now().
+        The calibration error grows with the distance from the first call, so it suits for
+        measuring short intervals. Falls back to now() if the processor has no invariant
+        time stamp counter. **/
+    static tick_count fast_now() {
+#if __TBB_x86_64 || __TBB_x86_32
+        static const time_stamp_calibration calibration{};
+        if (calibration.clock_periods_per_tick > 0) {
+            std::int64_t ticks = static_cast<std::int64_t>(machine_time_stamp() - calibration.base_ticks);
+            return calibration.base_time + clock_type::duration(clock_type::rep(ticks * calibration.clock_periods_per_tick));
+        }
+#endif
+        return now();
+    }
+
     //! Subtract two timestamps to get the time interval between
     friend interval_t operator-( const tick_count& t1, const tick_count& t0 ) {
         return tick_count::interval_t(t1.my_time_point - t0.my_time_point);
@@ -83,6 +108,23 @@ public:
     }
 
 private:
+#if __TBB_x86_64 || __TBB_x86_32
+    //! Matches the time stamp counter with clock_type
+    struct time_stamp_calibration {
+        clock_type::time_point base_time;
+        std::uint64_t base_ticks;
+        double clock_periods_per_tick;
+
+        time_stamp_calibration() {
+            std::uint64_t frequency = r1::time_stamp_frequency();
+            base_time = clock_type::now();
+            base_ticks = machine_time_stamp();
+            clock_periods_per_tick = frequency == 0 ? 0. :
+                double(clock_type::period::den) / (double(clock_type::period::num) * double(frequency));
+        }
+    };
+#endif
+
     clock_type::time_point my_time_point;
     tick_count( clock_type::time_point tp ) : my_time_point(tp) {}
 };
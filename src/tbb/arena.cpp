@@ -400,6 +400,7 @@ struct task_arena_impl {
     static void execute(d1::task_arena_base&, d1::delegate_base&);
     static void wait(d1::task_arena_base&);
     static int max_concurrency(const d1::task_arena_base*);
+    static int active_workers(const d1::task_arena_base*);
     static void enqueue(d1::task&, d1::task_group_context*, d1::task_arena_base*);
 };
 
@@ -423,6 +424,10 @@ int __TBB_EXPORTED_FUNC max_concurrency(const d1::task_arena_base* ta) {
     return task_arena_impl::max_concurrency(ta);
 }
 
+int __TBB_EXPORTED_FUNC active_workers(const d1::task_arena_base* ta) {
+    return task_arena_impl::active_workers(ta);
+}
+
 void __TBB_EXPORTED_FUNC enqueue(d1::task& t, d1::task_arena_base* ta) {
     task_arena_impl::enqueue(t, nullptr, ta);
 }
@@ -742,6 +747,17 @@ int task_arena_impl::max_concurrency(const d1::task_arena_base *ta) {
     return int(governor::default_num_threads());
 }
 
+int task_arena_impl::active_workers(const d1::task_arena_base* ta) {
+    arena* a = nullptr;
+    if (ta)
+        a = ta->my_arena.load(std::memory_order_relaxed);
+    else if (thread_data* td = governor::get_thread_data_if_initialized())
+        a = td->my_arena; // the current arena if any
+
+    // Workers that joined the arena are awake and take spawned tasks without a wakeup
+    return a ? int(a->num_workers_active()) : 0;
+}
+
 void isolate_within_arena(d1::delegate_base& d, std::intptr_t isolation) {
     // TODO: Decide what to do if the scheduler is not initialized. Is there a use case for it?
     thread_data* tls = governor::get_thread_data();
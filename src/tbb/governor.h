@@ -137,6 +137,8 @@ public:
     static bool wait_package_enabled() { return cpu_features.waitpkg_enabled; }
 #endif
 
+    static bool invariant_tsc_enabled() { return cpu_features.invariant_tsc_enabled; }
+
     static bool rethrow_exception_broken() { return is_rethrow_broken; }
 
     static bool is_itt_present() {
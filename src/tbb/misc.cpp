@@ -21,12 +21,15 @@
 #include "oneapi/tbb/detail/_machine.h"
 
 #include "oneapi/tbb/version.h"
+#include "oneapi/tbb/tick_count.h"
 
 #include "misc.h"
 #include "governor.h"
 #include "assert_impl.h" // Out-of-line TBB assertion handling routines are instantiated here.
 #include "concurrent_monitor_mutex.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <stdexcept>
@@ -137,9 +140,53 @@ void detect_cpu_features(cpu_features_type& cpu_features) {
     check_cpuid(7, 0, registers);
     cpu_features.rtm_enabled = (registers[1] & rtm_ebx_mask) != 0;
     cpu_features.waitpkg_enabled = (registers[2] & waitpkg_ecx_mask) != 0;
+
+    // Check that the time stamp counter runs at a constant rate in all ACPI P-, C- and T-states
+    const int invariant_tsc_edx_mask = 1 << 8;
+    check_cpuid(0x80000000, 0, registers);
+    if (unsigned(registers[0]) >= 0x80000007) {
+        check_cpuid(0x80000007, 0, registers);
+        cpu_features.invariant_tsc_enabled = (registers[3] & invariant_tsc_edx_mask) != 0;
+    }
 #endif /* (__TBB_x86_32 || __TBB_x86_64) */
 }
 
+//------------------------------------------------------------------------
+// Time stamp counter
+//------------------------------------------------------------------------
+
+#if __TBB_x86_32 || __TBB_x86_64
+//! Measures the frequency of the time stamp counter against the steady clock
+/** Takes the median of several short measurements not to depend on preemption. **/
+static std::uint64_t calibrate_time_stamp_frequency() {
+    using clock_type = std::chrono::steady_clock;
+    const auto period = std::chrono::milliseconds(2);
+    const int num_samples = 5;
+    double samples[num_samples];
+    for (int i = 0; i < num_samples; ++i) {
+        clock_type::time_point start_time = clock_type::now();
+        std::uint64_t start_ticks = machine_time_stamp();
+        clock_type::time_point finish_time;
+        do {
+            finish_time = clock_type::now();
+        } while (finish_time - start_time < period);
+        std::uint64_t finish_ticks = machine_time_stamp();
+        samples[i] = (finish_ticks - start_ticks) / std::chrono::duration<double>(finish_time - start_time).count();
+    }
+    std::sort(samples, samples + num_samples);
+    return std::uint64_t(samples[num_samples / 2]);
+}
+#endif
+
+std::uint64_t __TBB_EXPORTED_FUNC time_stamp_frequency() {
+#if __TBB_x86_32 || __TBB_x86_64
+    static const std::uint64_t frequency = governor::invariant_tsc_enabled() ? calibrate_time_stamp_frequency() : 0;
+    return frequency;
+#else
+    return 0;
+#endif
+}
+
 } // namespace r1
 } // namespace detail
 } // namespace tbb
@@ -176,21 +176,6 @@ public:
 };
 
 #if (_WIN32 || _WIN64 || __unix__ || __APPLE__) && (__TBB_x86_32 || __TBB_x86_64)
-#if _MSC_VER
-#pragma intrinsic(__rdtsc)
-#endif
-inline std::uint64_t machine_time_stamp() {
-#if __INTEL_COMPILER
-    return _rdtsc();
-#elif _MSC_VER
-    return __rdtsc();
-#else
-    std::uint32_t hi, lo;
-    __asm__ __volatile__("rdtsc" : "=d"(hi), "=a"(lo));
-    return (std::uint64_t(hi) << 32) | lo;
-#endif
-}
-
 inline void prolonged_pause_impl() {
     // Assumption based on practice: 1000-2000 ticks seems to be a suitable invariant for the
     // majority of platforms. Currently, skip platforms that define __TBB_STEALING_PAUSE
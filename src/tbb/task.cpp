@@ -221,6 +221,11 @@ void notify_waiters(std::uintptr_t wait_ctx_addr) {
     r1::governor::get_thread_data()->my_arena->my_market->get_wait_list().notify(is_related_wait_ctx);
 }
 
+d1::reference_vertex* get_thread_reference_vertex(d1::wait_context* wc) {
+    __TBB_ASSERT(wc, nullptr);
+    return &governor::get_thread_data()->my_reference_vertices.get(*wc);
+}
+
 } // namespace r1
 } // namespace detail
 } // namespace tbb
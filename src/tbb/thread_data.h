@@ -89,6 +89,81 @@ public:
     }
 };
 
+//! Reference vertices of the thread for the wait contexts shared with other threads
+/** A vertex without pending references is reused for another wait context, so the number
+    of vertices is bounded by the number of task groups that have outstanding tasks of the
+    thread. When the thread exits, the vertices still referenced by running tasks are
+    orphaned and deallocated by the last release (see d1::reference_vertex). **/
+class reference_vertex_map : no_copy {
+    struct vertex_node {
+        d1::reference_vertex* vertex;
+        vertex_node* next_node;
+    };
+
+    static constexpr std::size_t num_buckets = 16;
+    vertex_node* my_buckets[num_buckets]{};
+
+    //! The most recently requested vertex to skip the lookup for consecutive requests
+    d1::reference_vertex* my_last{};
+
+    static std::size_t bucket_index(d1::wait_context* wc) {
+        return (std::uintptr_t(wc) / max_nfs_size) % num_buckets;
+    }
+
+    static d1::reference_vertex* allocate_vertex(d1::wait_context& wc) {
+        // Occupy the whole cache line to avoid false sharing between vertices of different threads
+        static_assert(sizeof(d1::reference_vertex) <= max_nfs_size, "Reference vertex does not fit into the cache line");
+        return new (cache_aligned_allocate(max_nfs_size)) d1::reference_vertex(wc);
+    }
+
+public:
+    reference_vertex_map() = default;
+
+    ~reference_vertex_map() {
+        for (vertex_node*& head : my_buckets) {
+            for (vertex_node* n = head; n;) {
+                vertex_node* next = n->next_node;
+                if (n->vertex->orphan()) {
+                    cache_aligned_deallocate(n->vertex);
+                }
+                cache_aligned_deallocate(n);
+                n = next;
+            }
+            poison_pointer(head);
+        }
+        poison_pointer(my_last);
+    }
+
+    d1::reference_vertex& get(d1::wait_context& wc) {
+        if (my_last && my_last->parent() == &wc) {
+            return *my_last;
+        }
+
+        vertex_node*& head = my_buckets[bucket_index(&wc)];
+        vertex_node* vacant = nullptr;
+        for (vertex_node* n = head; n; n = n->next_node) {
+            if (n->vertex->parent() == &wc) {
+                my_last = n->vertex;
+                return *my_last;
+            }
+            if (!vacant && n->vertex->get_num_child() == 0) {
+                vacant = n;
+            }
+        }
+
+        if (vacant) {
+            // No task refers the vertex, so it can be rebound to another wait context
+            vacant->vertex->~reference_vertex();
+            new (vacant->vertex) d1::reference_vertex(wc);
+        } else {
+            vacant = new (cache_aligned_allocate(sizeof(vertex_node))) vertex_node{allocate_vertex(wc), head};
+            head = vacant;
+        }
+        my_last = vacant->vertex;
+        return *my_last;
+    }
+};
+
 //------------------------------------------------------------------------
 // Thread Data
 //------------------------------------------------------------------------
@@ -165,6 +240,9 @@ public:
     small_object_pool_impl* my_small_object_pool;
 
     context_list* my_context_list;
+
+    //! Reference vertices used to spread reference counting of shared wait contexts
+    reference_vertex_map my_reference_vertices;
 #if __TBB_RESUMABLE_TASKS
     //! Suspends the current coroutine (task_dispatcher).
     void suspend(void* suspend_callback, void* user_callback);
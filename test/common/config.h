@@ -42,6 +42,9 @@
 #ifndef TBB_PREVIEW_ISOLATED_TASK_GROUP
 #define TBB_PREVIEW_ISOLATED_TASK_GROUP 1
 #endif
+#ifndef TBB_PREVIEW_PARALLEL_REGION
+#define TBB_PREVIEW_PARALLEL_REGION 1
+#endif
 #endif
 
 #include "oneapi/tbb/detail/_config.h"
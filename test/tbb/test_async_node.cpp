@@ -33,9 +33,11 @@
 #include "common/test_follows_and_precedes_api.h"
 #include "common/concepts_common.h"
 
+#include <atomic>
 #include <string>
 #include <thread>
 #include <mutex>
+#include <vector>
 
 
 //! \file test_async_node.cpp
@@ -830,6 +832,142 @@ TEST_CASE("Inner enqueuing test"){
     run_test_enqueueing_on_inner_level();
 }
 
+#if __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+//! Completion source of a fake asynchronous activity: doubles the submitted values
+struct fake_completion_source {
+    std::mutex my_mutex;
+    std::vector<int> my_completed;
+
+    void submit(int value) {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_completed.push_back(2 * value);
+    }
+
+    std::vector<int> take_completed() {
+        std::vector<int> completed;
+        std::lock_guard<std::mutex> lock(my_mutex);
+        completed.swap(my_completed);
+        return completed;
+    }
+
+    //! Submits the completed values to the graph in a single batch
+    template <typename Gateway>
+    std::size_t deliver(Gateway& gateway) {
+        std::vector<int> completed = take_completed();
+        if (!completed.empty()) {
+            CHECK_FAST(gateway.try_put_batch(completed.data(), completed.size()) == completed.size());
+            for (std::size_t i = 0; i < completed.size(); ++i) {
+                gateway.release_wait();
+            }
+        }
+        return completed.size();
+    }
+};
+
+using batched_async_node = tbb::flow::async_node<int, int>;
+
+struct submit_to_source {
+    fake_completion_source* my_source;
+
+    void operator()(const int& value, batched_async_node::gateway_type& gateway) const {
+        gateway.reserve_wait();
+        my_source->submit(value);
+    }
+};
+
+struct poll_source {
+    fake_completion_source* my_source;
+    std::atomic<int>* my_polls;
+
+    std::size_t operator()(batched_async_node::gateway_type& gateway) const {
+        ++*my_polls;
+        return my_source->deliver(gateway);
+    }
+};
+
+struct collect_results {
+    std::vector<std::atomic<int>>* my_received;
+
+    void operator()(int value) const {
+        CHECK_FAST(value % 2 == 0);
+        ++(*my_received)[value / 2];
+    }
+};
+
+//! \brief \ref error_guessing
+TEST_CASE("async_node try_put_batch") {
+    constexpr int n = 10000;
+    for (int p = 1; p <= 4; ++p) {
+        tbb::global_control limit(tbb::global_control::max_allowed_parallelism, p);
+        fake_completion_source source;
+        std::vector<std::atomic<int>> received(n);
+        for (auto& r : received) {
+            r = 0;
+        }
+        tbb::flow::graph g;
+        batched_async_node a(g, tbb::flow::unlimited, submit_to_source{&source});
+        tbb::flow::function_node<int> results(g, tbb::flow::unlimited, collect_results{&received});
+        tbb::flow::make_edge(a, results);
+
+        std::atomic<bool> done{false};
+        // External activity delivering the completions in batches
+        std::thread completion_thread([&] {
+            while (!done) {
+                if (source.deliver(a.gateway()) == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            source.deliver(a.gateway());
+        });
+        for (int i = 0; i < n; ++i) {
+            a.try_put(i);
+        }
+        g.wait_for_all();
+        done = true;
+        completion_thread.join();
+        g.wait_for_all();
+        for (int i = 0; i < n; ++i) {
+            CHECK_FAST(received[i] == 1);
+        }
+    }
+}
+
+//! \brief \ref error_guessing
+TEST_CASE("async_node completion poller") {
+    constexpr int n = 10000;
+    for (int p = 1; p <= 4; ++p) {
+        tbb::global_control limit(tbb::global_control::max_allowed_parallelism, p);
+        fake_completion_source source;
+        std::atomic<int> polls{0};
+        std::vector<std::atomic<int>> received(n);
+        for (auto& r : received) {
+            r = 0;
+        }
+        tbb::flow::graph g;
+        batched_async_node a(g, tbb::flow::unlimited, submit_to_source{&source});
+        a.set_completion_poller(poll_source{&source, &polls});
+        tbb::flow::function_node<int> results(g, tbb::flow::unlimited, collect_results{&received});
+        tbb::flow::make_edge(a, results);
+
+        for (int round = 1; round <= 2; ++round) {
+            for (int i = 0; i < n; ++i) {
+                a.try_put(i);
+            }
+            // No external thread delivers the completions
+            g.wait_for_all();
+            for (int i = 0; i < n; ++i) {
+                CHECK_FAST(received[i] == round);
+            }
+            // The polling stops together with the asynchronous activity
+            const int polls_after_wait = polls;
+            CHECK(polls_after_wait > 0);
+            utils::Sleep(10);
+            CHECK(polls == polls_after_wait);
+        }
+    }
+}
+#endif // __TBB_PREVIEW_ASYNC_NODE_EXTENSIONS
+
 #if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
 //! Test deprecated follows and preceedes API
 //! \brief \ref error_guessing
@@ -14,9 +14,14 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_NOEXCEPT_ALGORITHMS 1
+
 #include "common/test.h"
 
 #include "tbb/parallel_for.h"
+#include "tbb/task.h"
+#include "tbb/task_group.h"
+#include "tbb/global_control.h"
 
 #include "common/config.h"
 #include "common/utils.h"
@@ -29,7 +34,9 @@
 #include "common/concepts_common.h"
 #include "test_partitioner.h"
 
+#include <atomic>
 #include <cstddef>
+#include <stdexcept>
 #include <vector>
 
 //! \file test_parallel_for.cpp
@@ -449,6 +456,65 @@ TEST_CASE("Сancellation test for tbb::parallel_for") {
     test_cancellation::ParallelForTestRunner</*FirstMode = */0>::run();
 }
 
+//! Testing that nested loops with noexcept bodies run in the context of the enclosing task
+//! \brief \ref error_guessing
+TEST_CASE("Nested parallel_for with noexcept body") {
+    using range_type = tbb::blocked_range<std::size_t>;
+    auto nothrow_body = [](const range_type&) noexcept {};
+    auto throwing_body = [](const range_type&) {};
+    static_assert(tbb::detail::d1::start_for<range_type, decltype(nothrow_body), const tbb::auto_partitioner>::is_nothrow_body,
+        "The noexcept body is not detected");
+    static_assert(!tbb::detail::d1::start_for<range_type, decltype(throwing_body), const tbb::auto_partitioner>::is_nothrow_body,
+        "The body that can throw is detected as noexcept");
+
+    const std::size_t N = 200;
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        std::vector<std::atomic<std::size_t>> counters(N);
+        std::atomic<std::size_t> foreign_contexts{0};
+        tbb::parallel_for(std::size_t(0), N, [&](std::size_t i) {
+            tbb::task_group_context* outer = tbb::task::current_context();
+            tbb::parallel_for(std::size_t(0), N, [&counters, &foreign_contexts, i, outer](std::size_t) noexcept {
+                if (tbb::task::current_context() != outer) {
+                    ++foreign_contexts;
+                }
+                ++counters[i];
+            });
+        });
+        REQUIRE(foreign_contexts == 0);
+        for (auto& c : counters) {
+            REQUIRE(c == N);
+        }
+    }
+}
+
+#if TBB_USE_EXCEPTIONS
+//! Range that throws on splitting
+struct ThrowingSplitRange : tbb::blocked_range<int> {
+    ThrowingSplitRange(int b, int e) : tbb::blocked_range<int>(b, e, 1) {}
+    ThrowingSplitRange(ThrowingSplitRange& r, tbb::split s) : tbb::blocked_range<int>(r, s) {
+        throw std::runtime_error("split");
+    }
+};
+
+//! Testing that an exception from the range of a nested loop with noexcept body reaches the enclosing group
+//! \brief \ref error_guessing
+TEST_CASE("Exception in nested parallel_for with noexcept body") {
+    tbb::task_group tg;
+    std::atomic<bool> nested_loop_returned{false};
+    tg.run([&] {
+        tbb::parallel_for(ThrowingSplitRange(0, 100), [](const ThrowingSplitRange&) noexcept {}, tbb::simple_partitioner());
+        nested_loop_returned = true;
+    });
+    REQUIRE_THROWS_AS(tg.wait(), std::runtime_error);
+    REQUIRE(nested_loop_returned);
+
+    // Outside of any task the loop has its own context and rethrows the exception
+    REQUIRE_THROWS_AS(tbb::parallel_for(ThrowingSplitRange(0, 100), [](const ThrowingSplitRange&) noexcept {},
+        tbb::simple_partitioner()), std::runtime_error);
+}
+#endif // TBB_USE_EXCEPTIONS
+
 #if __TBB_CPP20_CONCEPTS_PRESENT
 //! \brief \ref error_guessing
 TEST_CASE("parallel_for constraints") {
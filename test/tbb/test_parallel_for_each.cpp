@@ -109,6 +109,27 @@ TEST_CASE("That all workers sleep when no work") {
     TestCPUUserTime(utils::get_platform_max_threads());
 }
 
+//! Items are fed from the tasks executed by different threads into the same algorithm
+//! \brief \ref error_guessing \ref stress
+TEST_CASE("Feeding items from stolen tasks") {
+    const std::size_t depth = 12;
+    for (std::size_t p = 1; p <= 4; ++p) {
+        tbb::global_control limit(tbb::global_control::max_allowed_parallelism, p);
+        std::vector<std::size_t> roots(p, 0);
+        std::atomic<std::size_t> processed{0};
+        tbb::parallel_for_each(roots.begin(), roots.end(), [&](std::size_t level, tbb::feeder<std::size_t>& feeder) {
+            ++processed;
+            if (level < depth) {
+                // Add both copied and moved items to exercise both feeder paths
+                const std::size_t child = level + 1;
+                feeder.add(child);
+                feeder.add(level + 1);
+            }
+        });
+        REQUIRE(processed == p * ((std::size_t(1) << (depth + 1)) - 1));
+    }
+}
+
 #if __TBB_CPP20_CONCEPTS_PRESENT
 
 template <typename Iterator, typename Body>
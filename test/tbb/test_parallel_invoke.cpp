@@ -14,6 +14,8 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_NOEXCEPT_ALGORITHMS 1
+
 #include "common/test.h"
 #include "common/utils.h"
 #include "common/cpu_usertime.h"
@@ -21,6 +23,9 @@
 #include "common/parallel_invoke_common.h"
 #include "common/memory_usage.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/task.h"
+
 #include <cstddef>
 #include <atomic>
 
@@ -98,3 +103,34 @@ TEST_CASE("Test that all workers sleep when no work") {
     invoke_tree</*LevelTaskCount*/9, /*Depth*/6, /*WorkSize*/10>::generate_and_run();
     TestCPUUserTime(utils::get_platform_max_threads());
 }
+
+//! Testing that nested parallel_invoke with noexcept functors runs in the context of the enclosing task
+//! \brief \ref error_guessing
+TEST_CASE("Nested parallel_invoke with noexcept functors") {
+    auto nothrow_functor = []() noexcept {};
+    auto throwing_functor = [] {};
+    static_assert(tbb::detail::d1::is_nothrow_invoke<decltype(nothrow_functor), decltype(nothrow_functor)>::value,
+        "The noexcept functors are not detected");
+    static_assert(!tbb::detail::d1::is_nothrow_invoke<decltype(nothrow_functor), decltype(throwing_functor)>::value,
+        "The functor that can throw is detected as noexcept");
+
+    const std::size_t N = 100;
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        std::atomic<std::size_t> counter{0};
+        std::atomic<std::size_t> foreign_contexts{0};
+        tbb::parallel_for(std::size_t(0), N, [&](std::size_t) {
+            tbb::task_group_context* outer = tbb::task::current_context();
+            auto body = [&counter, &foreign_contexts, outer]() noexcept {
+                if (tbb::task::current_context() != outer) {
+                    ++foreign_contexts;
+                }
+                ++counter;
+            };
+            tbb::parallel_invoke(body, body);
+            tbb::parallel_invoke(body, body, body, body, body);
+        });
+        REQUIRE(counter == 7 * N);
+        REQUIRE(foreign_contexts == 0);
+    }
+}
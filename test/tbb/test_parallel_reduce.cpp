@@ -14,13 +14,19 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_NOEXCEPT_ALGORITHMS 1
+
 #include <atomic>
+#include <functional>
+#include <vector>
 
 #include "common/parallel_reduce_common.h"
 #include "common/cpu_usertime.h"
 #include "common/exception_handling.h"
 #include "common/concepts_common.h"
 
+#include "tbb/task.h"
+
 //! \file test_parallel_reduce.cpp
 //! \brief Test for [algorithms.parallel_reduce algorithms.parallel_deterministic_reduce] specification
 
@@ -632,6 +638,176 @@ TEST_CASE("cancellation test for tbb::parallel_deterministic_reduce") {
     test_cancellation::ParallelDeterministicReduceTestRunner</*First mode = */0>::run();
 }
 
+//! Testing that nested reductions with noexcept bodies run in the context of the enclosing task
+//! \brief \ref error_guessing
+TEST_CASE("Nested parallel_reduce with noexcept body") {
+    using range_type = tbb::blocked_range<std::size_t>;
+    auto nothrow_body = [](const range_type& r, std::size_t v) noexcept { return v + r.size(); };
+    auto nothrow_join = [](std::size_t x, std::size_t y) noexcept { return x + y; };
+    auto throwing_join = [](std::size_t x, std::size_t y) { return x + y; };
+    static_assert(tbb::detail::d1::is_nothrow_reduce_body<range_type,
+        tbb::detail::d1::lambda_reduce_body<range_type, std::size_t, decltype(nothrow_body), decltype(nothrow_join)>>::value,
+        "The noexcept reduction is not detected");
+    static_assert(!tbb::detail::d1::is_nothrow_reduce_body<range_type,
+        tbb::detail::d1::lambda_reduce_body<range_type, std::size_t, decltype(nothrow_body), decltype(throwing_join)>>::value,
+        "The reduction that can throw is detected as noexcept");
+
+    const std::size_t N = 200;
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        std::atomic<std::size_t> foreign_contexts{0};
+        std::size_t total = tbb::parallel_reduce(range_type(0, N), std::size_t(0),
+            [&](const range_type& r, std::size_t value) {
+                tbb::task_group_context* outer = tbb::task::current_context();
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    auto body = [&foreign_contexts, outer](const range_type& inner, std::size_t v) noexcept {
+                        if (tbb::task::current_context() != outer) {
+                            ++foreign_contexts;
+                        }
+                        return v + inner.size();
+                    };
+                    value += tbb::parallel_reduce(range_type(0, N), std::size_t(0), body, nothrow_join);
+                    value += tbb::parallel_deterministic_reduce(range_type(0, N), std::size_t(0), body, nothrow_join);
+                }
+                return value;
+            }, std::plus<std::size_t>());
+        REQUIRE(total == 2 * N * N);
+        REQUIRE(foreign_contexts == 0);
+    }
+}
+
+//! Reduction value that counts the copies of non-identity values
+class CopyCountingValue {
+public:
+    static std::atomic<std::size_t> unexpected_copies;
+
+    explicit CopyCountingValue( bool identity = false ) : my_is_identity(identity) {}
+    CopyCountingValue( const CopyCountingValue& other ) : my_sum(other.my_sum) {
+        if (!other.my_is_identity) {
+            ++unexpected_copies;
+        }
+    }
+    CopyCountingValue( CopyCountingValue&& other ) = default;
+    CopyCountingValue& operator=( const CopyCountingValue& other ) {
+        ++unexpected_copies;
+        my_sum = other.my_sum;
+        return *this;
+    }
+    CopyCountingValue& operator=( CopyCountingValue&& other ) = default;
+
+    std::size_t my_sum{0};
+private:
+    bool my_is_identity{false};
+};
+
+std::atomic<std::size_t> CopyCountingValue::unexpected_copies{0};
+
+template <typename Reduce>
+void TestMovingReduction( Reduce reduce ) {
+    using range_type = tbb::blocked_range<std::size_t>;
+    const std::size_t N = 10000;
+    const CopyCountingValue identity(/*identity = */true);
+    CopyCountingValue::unexpected_copies = 0;
+    CopyCountingValue result = reduce(range_type(0, N, 10), identity,
+        [](const range_type& r, CopyCountingValue&& value) {
+            value.my_sum += r.size();
+            return std::move(value);
+        },
+        [](CopyCountingValue&& x, CopyCountingValue&& y) {
+            x.my_sum += y.my_sum;
+            return std::move(x);
+        });
+    REQUIRE(result.my_sum == N);
+    REQUIRE(CopyCountingValue::unexpected_copies == 0);
+
+    // In-place accumulation and reduction
+    CopyCountingValue::unexpected_copies = 0;
+    result = reduce(range_type(0, N, 10), identity,
+        [](const range_type& r, CopyCountingValue& value) {
+            value.my_sum += r.size();
+        },
+        [](CopyCountingValue& x, CopyCountingValue&& y) {
+            x.my_sum += y.my_sum;
+        });
+    REQUIRE(result.my_sum == N);
+    REQUIRE(CopyCountingValue::unexpected_copies == 0);
+
+    // Functions taking constant references are still supported
+    CopyCountingValue::unexpected_copies = 0;
+    result = reduce(range_type(0, N, 10), identity,
+        [](const range_type& r, const CopyCountingValue& value) {
+            CopyCountingValue next;
+            next.my_sum = value.my_sum + r.size();
+            return next;
+        },
+        [](const CopyCountingValue& x, const CopyCountingValue& y) {
+            CopyCountingValue sum;
+            sum.my_sum = x.my_sum + y.my_sum;
+            return sum;
+        });
+    REQUIRE(result.my_sum == N);
+    REQUIRE(CopyCountingValue::unexpected_copies == 0);
+}
+
+struct DefaultReduce {
+    template <typename Range, typename Value, typename Body, typename Reduction>
+    Value operator()( const Range& range, const Value& identity, const Body& body, const Reduction& reduction ) const {
+        return tbb::parallel_reduce(range, identity, body, reduction);
+    }
+};
+
+struct SimpleReduce {
+    template <typename Range, typename Value, typename Body, typename Reduction>
+    Value operator()( const Range& range, const Value& identity, const Body& body, const Reduction& reduction ) const {
+        return tbb::parallel_reduce(range, identity, body, reduction, tbb::simple_partitioner());
+    }
+};
+
+struct DeterministicReduce {
+    template <typename Range, typename Value, typename Body, typename Reduction>
+    Value operator()( const Range& range, const Value& identity, const Body& body, const Reduction& reduction ) const {
+        return tbb::parallel_deterministic_reduce(range, identity, body, reduction);
+    }
+};
+
+//! Testing that the functional form moves the values instead of copying them
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_reduce moves the reduction values") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        TestMovingReduction(DefaultReduce{});
+        TestMovingReduction(SimpleReduce{});
+        TestMovingReduction(DeterministicReduce{});
+    }
+}
+
+//! Testing in-place reduction of large per-task histograms
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_reduce with in-place histograms") {
+    using histogram = std::vector<std::size_t>;
+    const std::size_t bins = 1024;
+    const std::size_t N = 100000;
+    histogram expected(bins, 0);
+    for (std::size_t i = 0; i < N; ++i) {
+        ++expected[(i * 7) % bins];
+    }
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        histogram result = tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, N), histogram(bins, 0),
+            [](const tbb::blocked_range<std::size_t>& r, histogram& h) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    ++h[(i * 7) % bins];
+                }
+            },
+            [](histogram& lhs, histogram&& rhs) {
+                for (std::size_t b = 0; b < bins; ++b) {
+                    lhs[b] += rhs[b];
+                }
+            });
+        REQUIRE(result == expected);
+    }
+}
+
 #if __TBB_CPP20_CONCEPTS_PRESENT
 //! \brief \ref error_guessing
 TEST_CASE("parallel_reduce constraints") {
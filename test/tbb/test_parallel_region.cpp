@@ -0,0 +1,169 @@
+/*
+    Copyright (c) 2005-2021 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_PARALLEL_REGION 1
+
+#include "common/test.h"
+#include "common/utils.h"
+#include "common/utils_concurrency_limit.h"
+
+#include "tbb/parallel_region.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#include "tbb/global_control.h"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+//! \file test_parallel_region.cpp
+//! \brief Test for [preview] functionality
+
+//! Checks that the members are numbered densely and that no member passes a barrier early
+void test_region_barrier(int max_members) {
+    constexpr int phases = 100;
+    std::atomic<int> arrived{0};
+    std::atomic<int> region_size{0};
+    std::vector<std::atomic<int>> indices(max_members);
+    for (auto& index : indices) {
+        index = 0;
+    }
+    tbb::parallel_region([&](tbb::parallel_region_member& member) {
+        REQUIRE(member.size() >= 1);
+        REQUIRE(member.size() <= max_members);
+        REQUIRE(member.index() >= 0);
+        REQUIRE(member.index() < member.size());
+        ++indices[member.index()];
+        region_size = member.size();
+        for (int phase = 0; phase < phases; ++phase) {
+            ++arrived;
+            member.barrier();
+            CHECK_FAST(arrived.load() >= member.size() * (phase + 1));
+            CHECK_FAST(arrived.load() <= member.size() * (phase + 2));
+        }
+    });
+    REQUIRE(arrived == region_size * phases);
+    for (int i = 0; i < max_members; ++i) {
+        REQUIRE(indices[i] == (i < region_size ? 1 : 0));
+    }
+}
+
+//! Applies a number of phases to the array; every phase must see the results of the previous one
+void test_region_parallel_for(std::size_t n, std::size_t grainsize) {
+    constexpr int phases = 50;
+    std::vector<int> current(n, 0), next(n, 0);
+    std::vector<std::atomic<int>> visits(n);
+    for (auto& v : visits) {
+        v = 0;
+    }
+    tbb::parallel_region([&](tbb::parallel_region_member& member) {
+        for (int phase = 0; phase < phases; ++phase) {
+            std::vector<int>& in = phase % 2 ? next : current;
+            std::vector<int>& out = phase % 2 ? current : next;
+            member.parallel_for(tbb::blocked_range<std::size_t>(0, n, grainsize), [&](const tbb::blocked_range<std::size_t>& r) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    // Read the neighbours written during the previous phase
+                    const int left = i > 0 ? in[i - 1] : phase;
+                    const int right = i + 1 < n ? in[i + 1] : phase;
+                    CHECK_FAST(left == phase);
+                    CHECK_FAST(right == phase);
+                    out[i] = in[i] + 1;
+                    ++visits[i];
+                }
+            });
+        }
+    });
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(visits[i] == phases);
+        REQUIRE((phases % 2 ? next : current)[i] == phases);
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_region barrier") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        test_region_barrier(static_cast<int>(concurrency_level));
+    }
+    // Arena with more slots than hardware threads
+    const int oversubscribed = static_cast<int>(utils::get_platform_max_threads()) + 1;
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, oversubscribed);
+    tbb::task_arena arena(oversubscribed);
+    arena.execute([&] {
+        test_region_barrier(oversubscribed);
+    });
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_region parallel_for") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        for (std::size_t n : {0, 1, 2, 7, 100, 10000}) {
+            test_region_parallel_for(n, 1);
+            test_region_parallel_for(n, 16);
+        }
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_region with nested algorithms") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        constexpr int n = 1000;
+        std::atomic<int> sum{0};
+        tbb::parallel_region([&](tbb::parallel_region_member& member) {
+            tbb::parallel_for(0, n, [&](int) { ++sum; });
+            member.barrier();
+            if (member.index() == 0) {
+                REQUIRE(sum == n * member.size());
+            }
+            member.barrier();
+            // Nested region
+            tbb::parallel_region([&](tbb::parallel_region_member& nested) {
+                nested.barrier();
+            });
+        });
+    }
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("Exception in parallel_region") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        for (int thrower = 0; thrower < static_cast<int>(concurrency_level); ++thrower) {
+            std::atomic<int> throw_count{0};
+            bool caught = false;
+            try {
+                tbb::parallel_region([&](tbb::parallel_region_member& member) {
+                    for (int phase = 0; phase < 10; ++phase) {
+                        if (phase == 5 && member.index() == thrower % member.size()) {
+                            ++throw_count;
+                            throw std::runtime_error("test");
+                        }
+                        member.barrier();
+                    }
+                });
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+            REQUIRE(caught);
+            REQUIRE(throw_count == 1);
+        }
+    }
+}
+#endif // TBB_USE_EXCEPTIONS
@@ -14,6 +14,8 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_ADAPTIVE_PARTITIONER 1
+
 #include "common/test.h"
 
 #include "tbb/parallel_for.h"
@@ -26,7 +28,9 @@
 #include "common/dummy_body.h"
 #include "common/spin_barrier.h"
 
+#include <atomic>
 #include <cstddef>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <algorithm> // std::min_element
@@ -195,3 +199,72 @@ TEST_CASE("Test partitioned tasks count and size for static_partitioner") {
 
     test_custom_range<custom_range_with_psplit>(1);
 }
+
+void test_adaptive_partitioner() {
+    for (std::size_t n : {std::size_t(1), std::size_t(10), std::size_t(1000), std::size_t(100000)}) {
+        std::vector<std::atomic<int>> visits(n);
+        tbb::adaptive_partitioner partitioner;
+        tbb::task_group_context context;
+        // Repeated calls let the partitioner switch between the execution modes
+        for (int call = 0; call < 20; ++call) {
+            for (auto& v : visits) {
+                v = 0;
+            }
+            auto body = [&visits](std::size_t i) { ++visits[i]; };
+            switch (call % 3) {
+            case 0:
+                tbb::parallel_for(std::size_t(0), n, body, partitioner);
+                break;
+            case 1:
+                tbb::parallel_for(std::size_t(0), n, body, partitioner, context);
+                break;
+            default:
+                tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n), [&](const tbb::blocked_range<std::size_t>& r) {
+                    for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                        body(i);
+                    }
+                }, partitioner);
+            }
+            for (auto& v : visits) {
+                REQUIRE(v == 1);
+            }
+        }
+    }
+}
+
+//! Testing that adaptive_partitioner processes each item exactly once in every execution mode
+//! \brief \ref requirement
+TEST_CASE("adaptive_partitioner correctness") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        test_adaptive_partitioner();
+    }
+    // An arena with more slots than the hardware threads exercises the parallel modes everywhere
+    tbb::task_arena arena(int(utils::get_platform_max_threads()) + 1);
+    arena.execute(test_adaptive_partitioner);
+}
+
+//! Testing that adaptive_partitioner runs loops with negligible work in the calling thread
+//! \brief \ref requirement
+TEST_CASE("adaptive_partitioner runs small loops serially") {
+    tbb::adaptive_partitioner partitioner;
+    std::atomic<int> foreign_items{0};
+    for (int call = 0; call < 10; ++call) {
+        foreign_items = 0;
+        const std::thread::id caller = std::this_thread::get_id();
+        tbb::parallel_for(0, 10, [&](int) {
+            if (std::this_thread::get_id() != caller) {
+                ++foreign_items;
+            }
+        }, partitioner);
+    }
+    // The first call measures the body and the dispatch; the last ones must not use other threads
+    REQUIRE(foreign_items == 0);
+
+    // A canceled context prevents the serial execution as well
+    tbb::task_group_context context;
+    context.cancel_group_execution();
+    std::atomic<int> executed{0};
+    tbb::parallel_for(0, 10, [&](int) { ++executed; }, partitioner, context);
+    REQUIRE(executed == 0);
+}
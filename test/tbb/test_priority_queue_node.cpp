@@ -29,6 +29,8 @@
 #include "common/test_follows_and_precedes_api.h"
 
 #include <cstdio>
+#include <atomic>
+#include <vector>
 
 
 //! \file test_priority_queue_node.cpp
@@ -403,6 +405,65 @@ TEST_CASE("Reset tests"){
     test_resets<float,tbb::flow::priority_queue_node<float> >();
 }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+using lock_free_priority_queue = tbb::flow::priority_queue_node<int, std::less<int>, tbb::flow::lock_free_buffering>;
+
+struct lock_free_puts : utils::NoAssign {
+    lock_free_priority_queue& my_q;
+    int my_num_threads;
+    int my_n;
+
+    lock_free_puts(lock_free_priority_queue& q, int num_threads, int n) : my_q(q), my_num_threads(num_threads), my_n(n) {}
+
+    void operator()(int tid) const {
+        for (int i = tid; i < my_n; i += my_num_threads) {
+            CHECK_FAST(my_q.try_put(i));
+        }
+    }
+};
+
+void test_lock_free_priority_queue(int num_threads, int n) {
+    tbb::flow::graph g;
+    lock_free_priority_queue q(g);
+
+    // Every staged item takes part in the priority order
+    utils::NativeParallelFor(num_threads, lock_free_puts(q, num_threads, n));
+    g.wait_for_all();
+    for (int i = n - 1; i >= 0; --i) {
+        int v = -1;
+        CHECK_FAST(q.try_get(v));
+        CHECK_FAST(v == i);
+    }
+    int v = -1;
+    CHECK(!q.try_get(v));
+
+    // Items put concurrently with the forwarding reach the successor exactly once
+    std::vector<std::atomic<int>> received(n);
+    for (auto& r : received) {
+        r = 0;
+    }
+    tbb::flow::function_node<int> consumer(g, tbb::flow::unlimited, [&](int i) { ++received[i]; });
+    tbb::flow::make_edge(q, consumer);
+    utils::NativeParallelFor(num_threads, lock_free_puts(q, num_threads, n));
+    g.wait_for_all();
+    for (int i = 0; i < n; ++i) {
+        CHECK_FAST(received[i] == 1);
+    }
+}
+
+//! Test priority_queue_node with the lock-free buffering policy under concurrent producers
+//! \brief \ref error_guessing
+TEST_CASE("priority_queue_node with lock_free_buffering") {
+    for (int p = 1; p <= 4; ++p) {
+        tbb::global_control thread_limit(tbb::global_control::max_allowed_parallelism, p);
+        for (int n : {1, 100, 5000}) {
+            test_lock_free_priority_queue(p, n);
+        }
+    }
+    test_resets<int, lock_free_priority_queue>();
+}
+#endif
+
 #if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
 //! Test follows and precedes API
 //! \brief \ref error_guessing
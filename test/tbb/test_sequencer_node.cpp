@@ -452,6 +452,78 @@ TEST_CASE("Serial and parallel test"){
 	}
 }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_LOCK_FREE_BUFFERING
+//! Every producer puts its tags in the reverse order, so most of the tags are far ahead of the
+//! next expected one at first and go around the ring
+struct reverse_puts : utils::NoAssign {
+    tbb::flow::sequencer_node<int, tbb::flow::lock_free_buffering>& my_s;
+    int my_num_threads;
+    int my_first;
+    int my_n;
+
+    reverse_puts(tbb::flow::sequencer_node<int, tbb::flow::lock_free_buffering>& s, int num_threads, int first, int n)
+        : my_s(s), my_num_threads(num_threads), my_first(first), my_n(n) {}
+
+    void operator()(int tid) const {
+        for (int j = my_first + my_n - 1 - tid; j >= my_first; j -= my_num_threads) {
+            CHECK_FAST(my_s.try_put(j));
+            // Duplicates are rejected both inside and outside of the ring window
+            CHECK_FAST(!my_s.try_put(j));
+        }
+    }
+};
+
+void test_lock_free_sequencer(int num_threads, int n) {
+    tbb::flow::graph g;
+    tbb::flow::sequencer_node<int, tbb::flow::lock_free_buffering> s(g, seq_inspector<int>());
+    int expected = 0;
+    bool in_order = true;
+    tbb::flow::function_node<int> consumer(g, tbb::flow::serial, [&](int v) {
+        in_order = in_order && v == expected;
+        ++expected;
+    });
+    tbb::flow::make_edge(s, consumer);
+
+    utils::NativeParallelFor(num_threads, reverse_puts(s, num_threads, 0, n));
+    g.wait_for_all();
+    CHECK(in_order);
+    CHECK(expected == n);
+    CHECK(!s.try_put(0));
+
+    // The items are kept until the successor is connected and then forwarded in order
+    tbb::flow::remove_edge(s, consumer);
+    utils::NativeParallelFor(num_threads, reverse_puts(s, num_threads, n, n));
+    g.wait_for_all();
+    int v = -1;
+    CHECK(s.try_get(v));
+    CHECK(v == n);
+    expected = n + 1;
+    tbb::flow::make_edge(s, consumer);
+    g.wait_for_all();
+    CHECK(in_order);
+    CHECK(expected == 2 * n);
+
+    // Reset rewinds the sequence
+    g.reset();
+    expected = 0;
+    CHECK(s.try_put(0));
+    g.wait_for_all();
+    CHECK(in_order);
+    CHECK(expected == 1);
+}
+
+//! Test sequencer_node with the lock-free buffering policy under concurrent producers
+//! \brief \ref error_guessing
+TEST_CASE("sequencer_node with lock_free_buffering") {
+    for (int p = 1; p <= 4; ++p) {
+        tbb::global_control thread_limit(tbb::global_control::max_allowed_parallelism, p);
+        for (int n : {1, 100, 5000}) {
+            test_lock_free_sequencer(p, n);
+        }
+    }
+}
+#endif
+
 #if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
 //! Test decution guides
 //! \brief \ref requirement
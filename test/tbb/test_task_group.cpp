@@ -20,11 +20,16 @@
 #include "tbb/global_control.h"
 
 #include "tbb/task_group.h"
+#include "tbb/task_arena.h"
+#include "tbb/tick_count.h"
 
 #include "common/concurrency_tracker.h"
+#include "common/utils_concurrency_limit.h"
 
 #include <atomic>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 //! \file test_task_group.cpp
 //! \brief Test for [scheduler.task_group scheduler.task_group_status] specification
@@ -1123,6 +1128,130 @@ TEST_CASE("Respect task_group_context passed from outside") {
 #endif
 }
 
+//! Many threads submit tasks into the same task_group concurrently with run and defer
+//! \brief \ref error_guessing \ref stress
+TEST_CASE("Concurrent producers for single task_group") {
+    const std::size_t num_tasks = 1000;
+    for (std::size_t p = MinThread; p <= MaxThread; ++p) {
+        tbb::global_control limit(tbb::global_control::max_allowed_parallelism, p);
+        tbb::task_group tg;
+        std::atomic<std::size_t> executed{0};
+        utils::NativeParallelFor(p, [&](std::size_t) {
+            for (std::size_t i = 0; i < num_tasks; ++i) {
+                tg.run([&] { ++executed; });
+                tg.run(tg.defer([&] { ++executed; }));
+            }
+            // Help to drain the tasks since the producers do not enter an arena with workers
+            tg.wait();
+        });
+        CHECK(tg.wait() == tbb::complete);
+        CHECK(executed == 2 * num_tasks * p);
+    }
+}
+
+//! Throughput of the task submission into single task_group by several producers
+//! \brief \ref stress
+TEST_CASE("task_group::run throughput with several producers") {
+    const std::size_t num_tasks = 100000;
+    for (std::size_t p = MinThread; p <= MaxThread; ++p) {
+        tbb::global_control limit(tbb::global_control::max_allowed_parallelism, p);
+        tbb::task_group tg;
+        std::atomic<std::size_t> executed{0};
+        tbb::tick_count t0 = tbb::tick_count::now();
+        utils::NativeParallelFor(p, [&](std::size_t) {
+            for (std::size_t i = 0; i < num_tasks; ++i) {
+                tg.run([&] { executed.fetch_add(1, std::memory_order_relaxed); });
+            }
+            tg.wait();
+        });
+        CHECK(tg.wait() == tbb::complete);
+        double seconds = (tbb::tick_count::now() - t0).seconds();
+        INFO("producers: " << p << ", tasks per second: " << double(num_tasks * p) / seconds);
+        CHECK(executed == num_tasks * p);
+    }
+}
+
+//! One thread switches between many task_groups, so its reference vertices are rebound to other groups
+//! \brief \ref error_guessing
+TEST_CASE("Single producer for many task_groups") {
+    const std::size_t num_groups = 64;
+    std::atomic<std::size_t> executed{0};
+    std::size_t expected = 0;
+    for (std::size_t round = 0; round < 8; ++round) {
+        // Recreate the groups each round to bind vertices to new addresses
+        std::vector<std::unique_ptr<tbb::task_group>> groups;
+        for (std::size_t i = 0; i < num_groups + round; ++i) {
+            groups.emplace_back(new tbb::task_group);
+        }
+        // The thread that created the groups refers their wait contexts directly,
+        // so submit the tasks from another thread
+        std::thread producer([&] {
+            for (std::size_t i = 0; i < 100; ++i) {
+                for (auto& tg : groups) {
+                    tg->run([&] { ++executed; });
+                    ++expected;
+                }
+                // Complete a part of the groups to release their vertices while others are busy
+                for (std::size_t g = i % 2; g < groups.size(); g += 2) {
+                    CHECK(groups[g]->wait() == tbb::complete);
+                }
+            }
+            for (auto& tg : groups) {
+                CHECK(tg->wait() == tbb::complete);
+            }
+        });
+        producer.join();
+        CHECK(executed == expected);
+    }
+}
+
+//! Destroying a deferred task_handle releases the reference of the task_group
+//! \brief \ref error_guessing
+TEST_CASE("Destroy task_handle without running") {
+    tbb::task_group tg;
+    std::atomic<std::size_t> executed{0};
+    utils::NativeParallelFor(MaxThread, [&](std::size_t) {
+        for (std::size_t i = 0; i < 100; ++i) {
+            tbb::task_handle dropped = tg.defer([&] { ++executed; });
+            tbb::task_handle moved = tg.defer([&] { ++executed; });
+            dropped = std::move(moved);
+            CHECK(dropped != nullptr);
+        }
+    });
+    CHECK(tg.wait() == tbb::complete);
+    CHECK(executed == 0);
+}
+
+//! The thread that submitted the tasks exits before they are completed and waited for by another thread
+//! \brief \ref error_guessing
+TEST_CASE("Producer thread exits before task_group wait") {
+    // The arena has a worker to execute the tasks left by the exited thread
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, 2);
+    tbb::task_arena arena(2);
+    for (int i = 0; i < 10; ++i) {
+        tbb::task_group tg;
+        std::atomic<bool> proceed{false};
+        std::atomic<std::size_t> executed{0};
+        std::thread producer([&] {
+            arena.execute([&] {
+                for (std::size_t t = 0; t < 10; ++t) {
+                    tg.run([&] {
+                        utils::SpinWaitUntilEq(proceed, true);
+                        ++executed;
+                    });
+                }
+            });
+        });
+        producer.join();
+        // The tasks still refer to the vertex of the exited thread
+        proceed = true;
+        arena.execute([&] {
+            CHECK(tg.wait() == tbb::complete);
+        });
+        CHECK(executed == 10);
+    }
+}
+
 #if __TBB_PREVIEW_TASK_GROUP_EXTENSIONS
 //! The test for task_handle inside other task waiting with run
 //! \brief \ref requirement
@@ -1154,6 +1283,204 @@ TEST_CASE("Task handle for scheduler bypass via run_and_wait"){
 
     CHECK_MESSAGE(run == true, "task handle returned by user lambda (bypassed) should be run");
 }
+//! The test for the order of tasks connected with make_edge
+//! \brief \ref requirement
+TEST_CASE("Task handles with predecessors") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        tbb::task_group tg;
+        std::atomic<int> step{0};
+        int a_step = -1, b_step = -1, c_step = -1, d_step = -1;
+
+        // Diamond a -> {b, c} -> d, submitted in the reverse order
+        tbb::task_handle a = tg.defer([&] { a_step = step++; });
+        tbb::task_handle b = tg.defer([&] { b_step = step++; });
+        tbb::task_handle c = tg.defer([&] { c_step = step++; });
+        tbb::task_handle d = tg.defer([&] { d_step = step++; });
+        tbb::make_edge(a, b);
+        tbb::make_edge(a, c);
+        tbb::make_edge(b, d);
+        tbb::make_edge(c, d);
+
+        tg.run(std::move(d));
+        tg.run(std::move(c));
+        tg.run(std::move(b));
+        CHECK_MESSAGE(step == 0, "Tasks with unfinished predecessors should not start");
+        tg.run_and_wait(std::move(a));
+
+        CHECK(a_step == 0);
+        CHECK(b_step > a_step);
+        CHECK(c_step > a_step);
+        CHECK(d_step == 3);
+    }
+}
+
+//! The test for a random graph of task handles
+//! \brief \ref requirement \ref stress
+TEST_CASE("Random graph of task handles") {
+    const std::size_t num_tasks = 1000;
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        utils::FastRandom<> rnd{std::uint64_t(concurrency_level)};
+        std::vector<std::atomic<bool>> done(num_tasks);
+        std::vector<std::vector<std::size_t>> predecessors(num_tasks);
+        std::atomic<std::size_t> violations{0};
+
+        tbb::task_group tg;
+        std::vector<tbb::task_handle> handles;
+        handles.reserve(num_tasks);
+        for (std::size_t i = 0; i < num_tasks; ++i) {
+            done[i] = false;
+            handles.push_back(tg.defer([&, i] {
+                for (std::size_t pred : predecessors[i]) {
+                    if (!done[pred]) {
+                        ++violations;
+                    }
+                }
+                done[i] = true;
+            }));
+            const std::size_t num_predecessors = i > 0 ? rnd.get() % 4 : 0;
+            for (std::size_t e = 0; e < num_predecessors; ++e) {
+                std::size_t pred = rnd.get() % i;
+                predecessors[i].push_back(pred);
+                tbb::make_edge(handles[pred], handles[i]);
+            }
+        }
+        // Submit in the random order
+        for (std::size_t i = 0; i < num_tasks; ++i) {
+            std::swap(handles[i], handles[rnd.get() % num_tasks]);
+        }
+        for (auto& h : handles) {
+            tg.run(std::move(h));
+        }
+        tg.wait();
+
+        CHECK(violations == 0);
+        for (std::size_t i = 0; i < num_tasks; ++i) {
+            REQUIRE(done[i]);
+        }
+    }
+}
+
+//! The test for destruction of task handles connected with make_edge
+//! \brief \ref error_guessing
+TEST_CASE("Discarded task handles with predecessors and successors") {
+    tbb::task_group tg;
+    std::atomic<int> executed{0};
+    {
+        tbb::task_handle a = tg.defer([&] { ++executed; });
+        tbb::task_handle b = tg.defer([&] { ++executed; });
+        tbb::task_handle c = tg.defer([&] { ++executed; });
+        tbb::make_edge(a, b);
+        tbb::make_edge(b, c);
+        tg.run(std::move(a));
+        tg.run(std::move(c));
+        // b is discarded, c still starts after a
+    }
+    tg.wait();
+    CHECK(executed == 2);
+
+    {
+        tbb::task_handle a = tg.defer([&] { ++executed; });
+        tbb::task_handle b = tg.defer([&] { ++executed; });
+        tbb::make_edge(a, b);
+        // Both are discarded
+    }
+    tg.wait();
+    CHECK(executed == 2);
+}
+
+//! The test for cancellation of task handles connected with make_edge
+//! \brief \ref error_guessing
+TEST_CASE("Cancellation of task handles with predecessors") {
+    tbb::task_group tg;
+    std::atomic<int> executed{0};
+    tbb::task_handle a = tg.defer([&] { ++executed; tg.cancel(); });
+    tbb::task_handle b = tg.defer([&] { ++executed; });
+    tbb::task_handle c = tg.defer([&] { ++executed; });
+    tbb::make_edge(a, b);
+    tbb::make_edge(b, c);
+    tg.run(std::move(c));
+    tg.run(std::move(b));
+    tg.run(std::move(a));
+    CHECK(tg.wait() == tbb::canceled);
+    CHECK(executed == 1);
+}
+//! Recursive Fibonacci with the joins expressed as continuations instead of blocking waits
+tbb::task_handle MakeContinuationFibTask(tbb::task_group& tg, std::uintptr_t n, std::uintptr_t* result) {
+    return tg.defer([&tg, n, result] {
+        if (n < 2) {
+            *result = n;
+            return;
+        }
+        auto partial = std::make_shared<std::pair<std::uintptr_t, std::uintptr_t>>(0, 0);
+        tbb::task_handle left = MakeContinuationFibTask(tg, n - 1, &partial->first);
+        tbb::task_handle right = MakeContinuationFibTask(tg, n - 2, &partial->second);
+        tbb::task_handle join = tg.defer([partial, result] {
+            *result = partial->first + partial->second;
+        });
+        tbb::make_edge(left, join);
+        tbb::make_edge(right, join);
+        tbb::task_group::transfer_this_task_completion_to(join);
+        tg.run(std::move(join));
+        tg.run(std::move(left));
+        tg.run(std::move(right));
+    });
+}
+
+//! The test for joins of recursive tasks without blocking waits
+//! \brief \ref requirement
+TEST_CASE("Transfer task completion to continuation") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        tbb::task_group tg;
+        std::uintptr_t result = 0;
+        std::uintptr_t observed = 0;
+
+        tbb::task_handle root = MakeContinuationFibTask(tg, N, &result);
+        // The successor of the root must see the final result of the whole recursion
+        tbb::task_handle check = tg.defer([&] { observed = result; });
+        tbb::make_edge(root, check);
+        tg.run(std::move(check));
+        tg.run_and_wait(std::move(root));
+
+        CHECK(result == F);
+        CHECK(observed == result);
+    }
+}
+
+//! The test for transfer of completion of a task without successors and of an outer task
+//! \brief \ref error_guessing
+TEST_CASE("Transfer task completion from nested tasks") {
+    tbb::task_group tg;
+    std::atomic<int> step{0};
+    int outer_step = -1, nested_step = -1, continuation_step = -1, successor_step = -1;
+
+    tbb::task_handle outer = tg.defer([&] {
+        // The nested task has no successors, so the transfer does not change anything
+        tbb::task_group nested_tg;
+        nested_tg.run_and_wait(nested_tg.defer([&] {
+            tbb::task_handle h = nested_tg.defer([&] { nested_step = step++; });
+            tbb::task_group::transfer_this_task_completion_to(h);
+            nested_tg.run(std::move(h));
+        }));
+        // The outer task is current again after the nested task completes
+        tbb::task_handle continuation = tg.defer([&] { continuation_step = step++; });
+        tbb::task_group::transfer_this_task_completion_to(continuation);
+        outer_step = step++;
+        tg.run(std::move(continuation));
+    });
+    tbb::task_handle successor = tg.defer([&] { successor_step = step++; });
+    tbb::make_edge(outer, successor);
+    tg.run(std::move(successor));
+    tg.run(std::move(outer));
+    tg.wait();
+
+    CHECK(nested_step == 0);
+    CHECK(outer_step == 1);
+    CHECK(continuation_step == 2);
+    CHECK(successor_step == 3);
+}
 #endif //__TBB_PREVIEW_TASK_GROUP_EXTENSIONS
 
 #if TBB_USE_EXCEPTIONS
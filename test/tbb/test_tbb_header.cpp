@@ -174,6 +174,7 @@ static void TestPreviewNames() {
     TestTypeDefinitionPresence2( blocked_rangeNd<int,4> );
     TestTypeDefinitionPresence2( concurrent_lru_cache<int, int> );
     TestTypeDefinitionPresence( isolated_task_group );
+    TestTypeDefinitionPresence( parallel_region_member );
 }
 #endif
 
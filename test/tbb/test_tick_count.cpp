@@ -20,6 +20,7 @@
 #include "common/spin_barrier.h"
 
 #include <tbb/tick_count.h>
+#include <cmath>
 #include <thread>
 
 //! \file test_tick_count.cpp
@@ -65,3 +66,50 @@ TEST_CASE("Test for subtracting calls to tick_count from different threads") {
         utils::NativeParallelFor(num_of_threads, diff_func);
     }
 }
+
+//! Test that the low overhead timestamps are consistent with tick_count::now()
+//! \brief \ref requirement
+TEST_CASE("tick_count::fast_now is consistent with tick_count::now") {
+    const double duration = 0.05;
+    for (int i = 0; i < 5; ++i) {
+        tbb::tick_count fast_start = tbb::tick_count::fast_now();
+        tbb::tick_count start = tbb::tick_count::now();
+        tbb::tick_count finish;
+        do {
+            finish = tbb::tick_count::now();
+        } while ((finish - start).seconds() < duration);
+        tbb::tick_count fast_finish = tbb::tick_count::fast_now();
+
+        double elapsed = (finish - start).seconds();
+        double fast_elapsed = (fast_finish - fast_start).seconds();
+        CHECK_GE(fast_elapsed, elapsed * 0.99);
+        // The thread can be preempted between the calls
+        CHECK_LT(fast_elapsed, elapsed * 1.01 + 0.01);
+        // Both timestamps come from the same timeline
+        CHECK_LT(std::abs((fast_finish - finish).seconds()), 0.01);
+    }
+}
+
+//! Test that the low overhead timestamps recorded on different threads can be subtracted
+//! \brief \ref error_guessing
+TEST_CASE("Test for subtracting calls to tick_count::fast_now from different threads") {
+    auto num_of_threads = utils::get_platform_max_threads();
+
+    utils::SpinBarrier thread_barrier(num_of_threads);
+    tbb::tick_count start_time;
+
+    auto diff_func = [&thread_barrier, &start_time] (std::size_t ) {
+        thread_barrier.wait([&start_time] { start_time = tbb::tick_count::fast_now(); });
+
+        tbb::tick_count end_time(tbb::tick_count::fast_now());
+        while ((end_time - start_time).seconds() <= 0) {
+            end_time = tbb::tick_count::fast_now();
+        }
+
+        CHECK_GT((end_time - start_time).seconds(), 0);
+    };
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        utils::NativeParallelFor(num_of_threads, diff_func);
+    }
+}